@@ -0,0 +1,64 @@
+// Compile-time benchmark: pipeline operations on a variant with ML_MOVAR_BENCH_ALTERNATIVES alternatives.
+// Only the time and memory needed to compile this file are measured.
+#include <ml/movar/movar.hpp>
+
+#ifndef ML_MOVAR_BENCH_ALTERNATIVES
+#define ML_MOVAR_BENCH_ALTERNATIVES 32
+#endif
+
+namespace
+{
+  namespace mp = boost::mp11;
+
+  template<int I>
+  struct message
+  {
+    int payload;
+  };
+
+  template<class I>
+  using message_at = message<I::value>;
+
+  constexpr int count = ML_MOVAR_BENCH_ALTERNATIVES;
+
+  using messages = mp::mp_transform<message_at, mp::mp_iota_c<count>>;
+  using all = mp::mp_rename<messages, ml::movar::variant>;
+  using half = mp::mp_rename<mp::mp_take_c<messages, count / 2>, ml::movar::maybe>;
+
+  // Every alternative maps to a distinct result, half of them into a variant.
+  struct next_fn
+  {
+    template<int I>
+    constexpr auto operator() (message<I> msg) const
+    {
+      if constexpr (I % 2 == 0)
+        return message<(I + 1) % count> {msg.payload + 1};
+      else
+        return ml::movar::either<message<I>, int> (msg);
+    }
+
+    constexpr int operator() (int x) const
+    {
+      return x;
+    }
+  };
+
+  constexpr next_fn next;
+
+  constexpr auto payload_or_value = [] (auto const& x) -> int {
+    if constexpr (std::same_as<std::remove_cvref_t<decltype (x)>, int>)
+      return x;
+    else
+      return x.payload;
+  };
+} // namespace
+
+// Result types only: instantiates the deduction of every operation without generating code for them.
+using mapped = decltype (std::declval<all const&> ().map (next).map (next));
+using matched = decltype (std::declval<mapped const&> ().match (payload_or_value));
+using fallback = decltype (std::declval<half const&> ().or_else ([] { return message<0> {0}; }));
+
+static_assert (ml::internal::movar::size<mapped> == count / 2 + 1);
+static_assert (ml::internal::movar::size<matched> == 1);
+static_assert (ml::internal::movar::size<fallback> == count / 2);
+static_assert (std::constructible_from<all, fallback>);
\ No newline at end of file
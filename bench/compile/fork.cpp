@@ -0,0 +1,52 @@
+// Compile-time benchmark: a fork of ML_MOVAR_BENCH_WIDTH filtered branches.
+#include <ml/movar/movar.hpp>
+#include <utility>
+
+#ifndef ML_MOVAR_BENCH_WIDTH
+#define ML_MOVAR_BENCH_WIDTH 8
+#endif
+
+namespace
+{
+  using ml::movar::filter;
+  using ml::movar::option;
+  using ml::movar::sequence;
+
+  template<int I>
+  struct tag
+  {
+    int value;
+  };
+
+  template<int I>
+  struct equals
+  {
+    constexpr bool operator() (int x) const
+    {
+      return x == I;
+    }
+  };
+
+  // Every branch has a distinct result type, so the fork result has one alternative per branch.
+  template<int I>
+  struct make_tag
+  {
+    constexpr tag<I> operator() (int x) const
+    {
+      return {x};
+    }
+  };
+
+  template<std::size_t... Is>
+  constexpr auto make_fork (std::index_sequence<Is...>)
+  {
+    return ((filter (equals<Is> {}) >> make_tag<Is> {}) | ...);
+  }
+
+  constexpr auto branches = make_fork (std::make_index_sequence<ML_MOVAR_BENCH_WIDTH> {});
+} // namespace
+
+int run (option<int> const& value)
+{
+  return value.map (branches).map_or ([] (auto x) { return x.value; }, -1).get ();
+}
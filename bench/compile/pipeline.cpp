@@ -0,0 +1,69 @@
+// Compile-time benchmark: a lazy pipeline with ML_MOVAR_BENCH_DEPTH stages applied to a variant.
+#include <ml/movar/movar.hpp>
+#include <utility>
+
+#ifndef ML_MOVAR_BENCH_DEPTH
+#define ML_MOVAR_BENCH_DEPTH 16
+#endif
+
+namespace
+{
+  using ml::movar::either;
+  using ml::movar::filter;
+  using ml::movar::sequence;
+  using ml::movar::variant;
+
+  struct positive
+  {
+    constexpr bool operator() (auto x) const
+    {
+      return x > 0;
+    }
+  };
+
+  struct decrement
+  {
+    constexpr auto operator() (auto x) const
+    {
+      return x - 1;
+    }
+  };
+
+  // Alternates between the two alternatives, so that every stage visits a variant.
+  struct swap
+  {
+    constexpr either<int, double> operator() (int x) const
+    {
+      return static_cast<double> (x);
+    }
+
+    constexpr either<int, double> operator() (double x) const
+    {
+      return static_cast<int> (x);
+    }
+  };
+
+  template<std::size_t I>
+  constexpr auto stage ()
+  {
+    if constexpr (I % 3 == 0)
+      return filter (positive {});
+    else if constexpr (I % 3 == 1)
+      return decrement {};
+    else
+      return swap {};
+  }
+
+  template<std::size_t... Is>
+  constexpr auto make_pipeline (std::index_sequence<Is...>)
+  {
+    return (sequence () >> ... >> stage<Is> ());
+  }
+
+  constexpr auto pipeline = make_pipeline (std::make_index_sequence<ML_MOVAR_BENCH_DEPTH> {});
+} // namespace
+
+long run (variant<int, double, float> const& value)
+{
+  return pipeline (value).map_or ([] (auto x) { return static_cast<long> (x); }, -1L).get ();
+}
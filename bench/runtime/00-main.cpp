@@ -0,0 +1,33 @@
+// Runtime benchmarks of movar against std::variant + std::visit and hand-written switches.
+// Build in release mode; instructions per operation are reported when perf events are available.
+#include "01-visit.hpp"
+#include "02-pipeline.hpp"
+#include "03-hash.hpp"
+#include "04-sorted.hpp"
+#include "05-collection.hpp"
+#include "06-column.hpp"
+#include "07-partition.hpp"
+#include "08-serialize.hpp"
+#include "09-archive.hpp"
+#include "10-atomic.hpp"
+
+int main ()
+{
+  using bench::distribution;
+
+  bench::print_header ();
+  for (auto dist : {distribution::uniform, distribution::skewed}) {
+    bench::visit_benchmarks<2> (dist);
+    bench::visit_benchmarks<8> (dist);
+    bench::visit_benchmarks<32> (dist);
+    bench::pipeline_benchmarks<8> (dist);
+    bench::hash_benchmarks<8> (dist);
+    bench::sorted_benchmarks<8> (dist);
+    bench::collection_benchmarks<8> (dist);
+    bench::column_benchmarks<8> (dist);
+    bench::partition_benchmarks<8> (dist);
+    bench::serialize_benchmarks<8> (dist);
+    bench::archive_benchmarks<8> (dist);
+    bench::atomic_benchmarks<8> (dist);
+  }
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include "common.hpp"
+
+// Single operations on variants of N alternatives: movar, std::variant + std::visit and a switch.
+namespace bench
+{
+  template<int N>
+  void visit_benchmarks (distribution dist)
+  {
+    auto const idx = indices (N, dist);
+    auto const movar_values = make_inputs<movar_variant<N>, N> (idx, false);
+    auto const movar_optionals = make_inputs<movar_maybe<N>, N> (idx, true);
+    auto const std_values = make_inputs<std_variant<N>, N> (idx, false);
+    auto const std_optionals = make_inputs<std_optional_variant<N>, N> (idx, true);
+    auto const tagged_values = make_inputs<tagged, N> (idx, false);
+    auto const tagged_optionals = make_inputs<tagged, N> (idx, true);
+    std::size_t const count = idx.size ();
+
+    auto const sum = [] (auto const& inputs, auto&& fn) {
+      return [&inputs, fn] () {
+        int total = 0;
+        for (auto const& input : inputs)
+          total += fn (input);
+        keep (total);
+      };
+    };
+
+    // map: visit every alternative, no empty state
+    run ("map", N, dist, "movar", count, sum (movar_values, [] (auto const& v) { return v.map (weigh {}).get (); }));
+    run ("map", N, dist, "std::visit", count, sum (std_values, [] (auto const& v) { return std::visit (weigh {}, v); }));
+    run ("map", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      return dispatch<N> (t, [] (auto a) { return weigh {}(a); });
+    }));
+
+    // match: the empty state is a case of the visitor
+    run ("match", N, dist, "movar", count, sum (movar_optionals, [] (auto const& v) {
+      return v.match (weigh {}).get ();
+    }));
+    run ("match", N, dist, "std::visit", count, sum (std_optionals, [] (auto const& v) {
+      return std::visit (weigh {}, v);
+    }));
+    run ("match", N, dist, "switch", count, sum (tagged_optionals, [] (tagged t) { return weigh_tagged (t); }));
+
+    // map_or: the empty state maps to a default
+    run ("map_or", N, dist, "movar", count, sum (movar_optionals, [] (auto const& v) {
+      return v.map_or (weigh {}, -1).get ();
+    }));
+    run ("map_or", N, dist, "std::visit", count, sum (std_optionals, [] (auto const& v) {
+      return v.index () == 0 ? -1 : std::visit (weigh {}, v);
+    }));
+    run ("map_or", N, dist, "switch", count, sum (tagged_optionals, [] (tagged t) {
+      return t.tag < 0 ? -1 : dispatch<N> (t, [] (auto a) { return weigh {}(a); });
+    }));
+
+    // The operations below build a variant: every implementation keeps the whole result, tag and payload.
+
+    // or_else: the empty state is replaced by the first alternative
+    run ("or_else", N, dist, "movar", count, sum (movar_optionals, [] (auto const& v) {
+      auto const result = v.or_else ([] { return alt<0> {0}; });
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("or_else", N, dist, "std::visit", count, sum (std_optionals, [] (auto const& v) {
+      auto const result = std::visit (
+        [] (auto const& a) -> std_variant<N> {
+          if constexpr (std::same_as<decltype (a), std::monostate const&>)
+            return alt<0> {0};
+          else
+            return a;
+        },
+        v);
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("or_else", N, dist, "switch", count, sum (tagged_optionals, [] (tagged t) {
+      tagged const result = t.tag < 0 ? tagged {0, 0} : t;
+      keep (result);
+      return result.tag;
+    }));
+
+    // take: move the value out of a variant that can be empty, known to hold a value
+    run ("take", N, dist, "movar", count, sum (movar_values, [] (auto const& v) {
+      movar_maybe<N> copy (v);
+      auto const result = std::move (copy).take ();
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("take", N, dist, "std::visit", count, sum (std_values, [] (auto const& v) {
+      std_optional_variant<N> copy = std::visit ([] (auto a) -> std_optional_variant<N> { return a; }, v);
+      auto const result = std::visit (
+        [] (auto a) -> std_variant<N> {
+          if constexpr (std::same_as<decltype (a), std::monostate>)
+            std::abort ();
+          else
+            return a;
+        },
+        std::move (copy));
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("take", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      tagged copy = t;
+      if (copy.tag < 0)
+        std::abort ();
+      tagged const result = copy;
+      keep (result);
+      return result.tag;
+    }));
+
+    // cast: convert to a variant with an additional alternative
+    using movar_wider = mp::mp_rename<mp::mp_push_back<alts<N>, double>, ml::movar::variant>;
+    using std_wider = mp::mp_rename<mp::mp_push_back<alts<N>, double>, std::variant>;
+    run ("cast", N, dist, "movar", count, sum (movar_values, [] (auto const& v) {
+      movar_wider const result (v);
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("cast", N, dist, "std::visit", count, sum (std_values, [] (auto const& v) {
+      auto const result = std::visit ([] (auto a) -> std_wider { return a; }, v);
+      keep (result);
+      return static_cast<int> (result.index ());
+    }));
+    run ("cast", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      // the payload is shared by all alternatives, so the wider variant has the same representation
+      tagged const result {t.tag, t.value};
+      keep (result);
+      return result.tag;
+    }));
+  }
+} // namespace bench
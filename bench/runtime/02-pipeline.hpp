@@ -0,0 +1,143 @@
+#pragma once
+#include "common.hpp"
+
+// Pipelines of several stages: movar pipelines, chained std::visit calls and a single fused switch.
+namespace bench
+{
+  struct add_one
+  {
+    template<int I>
+    alt<I> operator() (alt<I> a) const
+    {
+      return {a.value + 1};
+    }
+  };
+
+  struct times_two
+  {
+    template<int I>
+    alt<I> operator() (alt<I> a) const
+    {
+      return {a.value * 2};
+    }
+  };
+
+  struct is_even
+  {
+    template<int I>
+    bool operator() (alt<I> a) const
+    {
+      return a.value % 2 == 0;
+    }
+  };
+
+  struct payload
+  {
+    template<int I>
+    int operator() (alt<I> a) const
+    {
+      return a.value;
+    }
+  };
+
+  template<int N>
+  void pipeline_benchmarks (distribution dist)
+  {
+    using ml::movar::filter;
+    using ml::movar::sequence;
+
+    auto const idx = indices (N, dist);
+    auto const movar_values = make_inputs<movar_variant<N>, N> (idx, false);
+    auto const std_values = make_inputs<std_variant<N>, N> (idx, false);
+    auto const tagged_values = make_inputs<tagged, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    auto const sum = [] (auto const& inputs, auto&& fn) {
+      return [&inputs, fn] () {
+        int total = 0;
+        for (auto const& input : inputs)
+          total += fn (input);
+        keep (total);
+      };
+    };
+
+    auto const std_map = [] (auto const& fn, auto const& v) {
+      return std::visit ([&fn] (auto a) -> std_variant<N> { return fn (a); }, v);
+    };
+
+    // sequence: three stages on every alternative
+    auto const three_stages = sequence () >> add_one {} >> times_two {} >> add_one {};
+    run ("sequence", N, dist, "movar", count, sum (movar_values, [three_stages] (auto const& v) {
+      return v.map (three_stages).map_or (payload {}, 0).get ();
+    }));
+    run ("sequence", N, dist, "std::visit", count, sum (std_values, [std_map] (auto const& v) {
+      return std::visit (payload {}, std_map (add_one {}, std_map (times_two {}, std_map (add_one {}, v))));
+    }));
+    run ("sequence", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      return dispatch<N> (t, [] (auto a) {
+        if constexpr (std::same_as<decltype (a), ml::movar::nothing>)
+          return 0;
+        else
+          return payload {}(add_one {}(times_two {}(add_one {}(a))));
+      });
+    }));
+
+    // filter: keep even payloads, then map
+    auto const filtered = filter (is_even {}) >> add_one {};
+    run ("filter", N, dist, "movar", count, sum (movar_values, [filtered] (auto const& v) {
+      return v.map (filtered).map_or (payload {}, -1).get ();
+    }));
+    run ("filter", N, dist, "std::visit", count, sum (std_values, [] (auto const& v) {
+      auto const result = std::visit (
+        [] (auto a) -> std_optional_variant<N> {
+          if (is_even {}(a))
+            return add_one {}(a);
+          return std::monostate {};
+        },
+        v);
+      return result.index () == 0 ? -1 : std::visit (weigh {}, result);
+    }));
+    run ("filter", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      return dispatch<N> (t, [] (auto a) {
+        if constexpr (std::same_as<decltype (a), ml::movar::nothing>)
+          return -1;
+        else
+          return is_even {}(a) ? payload {}(add_one {}(a)) : -1;
+      });
+    }));
+
+    // fork: the first branch whose filter accepts the input
+    auto const forked = (filter (is_even {}) >> add_one {}) | (sequence () >> times_two {});
+    run ("fork", N, dist, "movar", count, sum (movar_values, [forked] (auto const& v) {
+      return v.map (forked).map_or (payload {}, -1).get ();
+    }));
+    run ("fork", N, dist, "std::visit", count, sum (std_values, [] (auto const& v) {
+      return std::visit (
+        [] (auto a) {
+          if (is_even {}(a))
+            return payload {}(add_one {}(a));
+          return payload {}(times_two {}(a));
+        },
+        v);
+    }));
+    run ("fork", N, dist, "switch", count, sum (tagged_values, [] (tagged t) {
+      return dispatch<N> (t, [] (auto a) {
+        if constexpr (std::same_as<decltype (a), ml::movar::nothing>)
+          return -1;
+        else
+          return is_even {}(a) ? payload {}(add_one {}(a)) : payload {}(times_two {}(a));
+      });
+    }));
+
+    // chained maps, eager and fused with lazy_map
+    run ("map chain", N, dist, "movar", count, sum (movar_values, [] (auto const& v) {
+      return v.map (add_one {}).map (times_two {}).map (add_one {}).map (payload {}).get ();
+    }));
+    run ("map chain", N, dist, "movar lazy_map", count, sum (movar_values, [] (auto const& v) {
+      return v.lazy_map (add_one {}).map (times_two {}).map (add_one {}).map (payload {}).eval ().get ();
+    }));
+    run ("map chain", N, dist, "std::visit", count, sum (std_values, [std_map] (auto const& v) {
+      return std::visit (payload {}, std_map (add_one {}, std_map (times_two {}, std_map (add_one {}, v))));
+    }));
+  }
+} // namespace bench
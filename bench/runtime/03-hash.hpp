@@ -0,0 +1,64 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+#include <unordered_map>
+
+template<int I>
+struct std::hash<bench::alt<I>>
+{
+  std::size_t operator() (bench::alt<I> a) const noexcept
+  {
+    return std::hash<int> {}(a.value);
+  }
+};
+
+// Hash lookups keyed by variants: variant_map, and std::unordered_map keyed by movar and std variants.
+namespace bench
+{
+  template<int N>
+  void hash_benchmarks (distribution dist)
+  {
+    auto const idx = indices (N, dist);
+    auto const movar_values = make_inputs<movar_variant<N>, N> (idx, false);
+    auto const std_values = make_inputs<std_variant<N>, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    // every other input is a key, so that half of the lookups fail
+    ml::movar::variant_map<movar_variant<N>, int> movar_map;
+    std::unordered_map<movar_variant<N>, int> movar_unordered;
+    std::unordered_map<std_variant<N>, int> std_unordered;
+    for (std::size_t i = 0; i < count; i += 2) {
+      movar_map.try_emplace (movar_values[i], static_cast<int> (i));
+      movar_unordered.try_emplace (movar_values[i], static_cast<int> (i));
+      std_unordered.try_emplace (std_values[i], static_cast<int> (i));
+    }
+
+    auto const lookup = [] (auto const& inputs, auto const& map) {
+      return [&inputs, &map] () {
+        int total = 0;
+        for (auto const& input : inputs) {
+          auto const it = map.find (input);
+          total += it == map.end () ? -1 : it->second;
+        }
+        keep (total);
+      };
+    };
+
+    run ("hash lookup", N, dist, "variant_map", count, lookup (movar_values, movar_map));
+    run ("hash lookup", N, dist, "unordered movar", count, lookup (movar_values, movar_unordered));
+    run ("hash lookup", N, dist, "unordered std", count, lookup (std_values, std_unordered));
+
+    auto const insert = [] (auto const& inputs, auto map) {
+      return [&inputs, map] () mutable {
+        map.clear ();
+        for (auto const& input : inputs)
+          map.try_emplace (input, 0);
+        keep (map.size ());
+      };
+    };
+
+    run ("hash insert", N, dist, "variant_map", count, insert (movar_values, movar_map));
+    run ("hash insert", N, dist, "unordered movar", count, insert (movar_values, movar_unordered));
+    run ("hash insert", N, dist, "unordered std", count, insert (std_values, std_unordered));
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+#include <algorithm>
+#include <set>
+
+// Ordered keys: sorting with the default comparison and index_first_less, and lookups in
+// flat_variant_set, in a sorted vector and in std::set.
+namespace bench
+{
+  template<int N>
+  void sorted_benchmarks (distribution dist)
+  {
+    using key = movar_variant<N>;
+
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<key, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    auto const sort = [&values] (auto less) {
+      return [&values, less] () {
+        auto copy = values;
+        std::sort (copy.begin (), copy.end (), less);
+        keep (copy.front ().index ());
+      };
+    };
+
+    run ("sort", N, dist, "operator<", count, sort (std::less<key> {}));
+    run ("sort", N, dist, "index_first_less", count, sort (ml::movar::index_first_less<key> {}));
+
+    // every other input is a key, so that half of the lookups fail
+    std::vector<key> keys;
+    for (std::size_t i = 0; i < count; i += 2)
+      keys.push_back (values[i]);
+    ml::movar::flat_variant_set<key> const flat (keys.begin (), keys.end ());
+    std::set<key> const tree (keys.begin (), keys.end ());
+    std::vector<key> sorted (flat.begin (), flat.end ());
+
+    auto const lookup = [&values] (auto&& contains) {
+      return [&values, contains] () {
+        int total = 0;
+        for (auto const& value : values)
+          total += contains (value);
+        keep (total);
+      };
+    };
+
+    run ("ordered find", N, dist, "flat_variant_set", count, lookup ([&flat] (key const& k) {
+      return flat.contains (k);
+    }));
+    run ("ordered find", N, dist, "sorted vector", count, lookup ([&sorted] (key const& k) {
+      return std::binary_search (sorted.begin (), sorted.end (), k);
+    }));
+    run ("ordered find", N, dist, "std::set", count, lookup ([&tree] (key const& k) {
+      return tree.contains (k);
+    }));
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+
+// Iterating heterogeneous elements: a vector of variants visited element by element, and a
+// variant_collection visited segment by segment.
+namespace bench
+{
+  template<int N>
+  void collection_benchmarks (distribution dist)
+  {
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<movar_variant<N>, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    ml::movar::variant_collection_for<movar_variant<N>> collection;
+    for (auto const& value : values)
+      collection.insert (value);
+
+    run ("iterate", N, dist, "vector<variant>", count, [&values] () {
+      int total = 0;
+      for (auto const& value : values)
+        total += value.match (weigh {}).get ();
+      keep (total);
+    });
+    run ("iterate", N, dist, "collection", count, [&collection] () {
+      int total = 0;
+      collection.match_each ([&total] (auto const& a) { total += weigh {}(a); });
+      keep (total);
+    });
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+#include <algorithm>
+
+// Scanning for one alternative: a vector of variants tested element by element, and a variant_column
+// whose tag array is compared 16 rows at a time.
+namespace bench
+{
+  template<int N>
+  void column_benchmarks (distribution dist)
+  {
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<movar_variant<N>, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    ml::movar::variant_column_for<movar_variant<N>> column;
+    column.reserve (count);
+    for (auto const& value : values)
+      column.push_back (value);
+
+    run ("count", N, dist, "vector<variant>", count, [&values] () {
+      keep (std::ranges::count_if (values, [] (auto const& value) { return value.template is<alt<0>> (); }));
+    });
+    run ("count", N, dist, "column", count, [&column] () { keep (column.template count<alt<0>> ()); });
+    run ("positions", N, dist, "vector<variant>", count, [&values] () {
+      std::vector<std::uint32_t> rows;
+      for (std::size_t i = 0; i != values.size (); ++i)
+        if (values[i].template is<alt<0>> ())
+          rows.push_back (static_cast<std::uint32_t> (i));
+      keep (rows.size ());
+    });
+    run ("positions", N, dist, "column", count, [&column] () {
+      keep (column.template positions<alt<0>> ().size ());
+    });
+  }
+} // namespace bench
\ No newline at end of file
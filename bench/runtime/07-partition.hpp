@@ -0,0 +1,43 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+#include <algorithm>
+
+// Grouping a range by alternative: one std::stable_partition per alternative, std::stable_sort on
+// the index, and the counting sorts partition_by_alternative and stable_sort_by_index. Each run
+// copies the inputs first.
+namespace bench
+{
+  template<int N>
+  void partition_benchmarks (distribution dist)
+  {
+    using var = movar_variant<N>;
+
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<var, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    run ("group", N, dist, "stable_partition", count, [&values] () {
+      auto copy = values;
+      auto first = copy.begin ();
+      [&]<std::size_t... I> (std::index_sequence<I...>) {
+        auto const holds = [] (long index) { return [index] (var const& v) { return v.index () == index; }; };
+        ((first = std::stable_partition (first, copy.end (), holds (I))), ...);
+      }(std::make_index_sequence<N - 1> {});
+      keep (copy.front ().index ());
+    });
+    run ("group", N, dist, "stable_sort", count, [&values] () {
+      auto copy = values;
+      std::ranges::stable_sort (copy, {}, [] (var const& v) { return v.index (); });
+      keep (copy.front ().index ());
+    });
+    run ("group", N, dist, "partition_by_alt", count, [&values] () {
+      auto copy = values;
+      keep (ml::movar::partition_by_alternative (copy).template segment<0> ().size ());
+    });
+    run ("group", N, dist, "sort_by_index", count, [&values] () {
+      auto copy = values;
+      keep (ml::movar::stable_sort_by_index (copy).template segment<0> ().size ());
+    });
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/serialize.hpp>
+#include <cstring>
+#include <variant>
+
+// Serialization throughput: variants written and read one at a time with binary_writer and
+// binary_reader, against a hand-written loop that stores a std::variant as its index byte and a memcpy
+// of the alternative, and arrays of integers written as one bulk copy.
+namespace bench
+{
+  template<int N>
+  void serialize_benchmarks (distribution dist)
+  {
+    using var = movar_variant<N>;
+
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<var, N> (idx, false);
+    auto const std_values = make_inputs<std_variant<N>, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    std::vector<std::byte> buffer (count * (sizeof (var) + 1));
+    ml::movar::binary_writer encoded (buffer);
+    for (auto const& value : values)
+      encoded.write (value);
+
+    run ("serialize", N, dist, "binary_writer", count, [&values, &buffer] () {
+      ml::movar::binary_writer out (buffer);
+      for (auto const& value : values)
+        out.write (value);
+      keep (out.size ());
+    });
+    run ("serialize", N, dist, "std::variant", count, [&std_values, &buffer] () {
+      std::size_t size = 0;
+      for (auto const& value : std_values) {
+        auto const copy = [&buffer, &size] (auto const& a) {
+          std::memcpy (buffer.data () + size, &a, sizeof (a));
+          size += sizeof (a);
+        };
+        buffer[size++] = static_cast<std::byte> (value.index ());
+        std::visit (copy, value);
+      }
+      keep (size);
+    });
+    run ("deserialize", N, dist, "binary_reader", count, [&encoded, count] () {
+      ml::movar::binary_reader in (encoded.written ());
+      int total = 0;
+      for (std::size_t i = 0; i != count; ++i)
+        total += in.read<var> ().get ().match (weigh {}).get ();
+      keep (total);
+    });
+
+    run ("deserialize", N, dist, "std::variant", count, [&encoded, count] () {
+      std::span<std::byte const> const in = encoded.written ();
+      std::size_t position = 0;
+      int total = 0;
+      for (std::size_t i = 0; i != count; ++i) {
+        auto const index = std::to_integer<std::size_t> (in[position++]);
+        auto const value = mp::mp_with_index<N> (index, [&] (auto I) {
+          std::variant_alternative_t<I, std_variant<N>> a;
+          std::memcpy (&a, in.data () + position, sizeof (a));
+          position += sizeof (a);
+          return std_variant<N> (std::in_place_index<I>, a);
+        });
+        total += std::visit (weigh {}, value);
+      }
+      keep (total);
+    });
+
+    std::vector<int> const integers (count, 7);
+    run ("serialize", N, dist, "vector<int> bulk", count, [&integers, &buffer] () {
+      ml::movar::binary_writer out (buffer);
+      out.write (integers);
+      keep (out.size ());
+    });
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/container.hpp>
+#include <ml/movar/serialize.hpp>
+
+// Loading a table of variants and reading every row once: decoding it with binary_reader into a vector,
+// and opening an archive and reading its rows in place.
+namespace bench
+{
+  template<int N>
+  void archive_benchmarks (distribution dist)
+  {
+    using var = movar_variant<N>;
+
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<var, N> (idx, false);
+    std::size_t const count = idx.size ();
+
+    std::vector<std::byte> encoded (count * (sizeof (var) + 1));
+    ml::movar::binary_writer out (encoded);
+    ml::movar::variant_column_for<var> column;
+    for (auto const& value : values) {
+      out.write (value);
+      column.push_back (value);
+    }
+    encoded.resize (out.size ());
+    std::vector<std::byte> const archive = ml::movar::make_archive (column);
+
+    run ("load", N, dist, "binary_reader", count, [&encoded, count] () {
+      ml::movar::binary_reader in (encoded);
+      std::vector<var> table;
+      table.reserve (count);
+      for (std::size_t i = 0; i != count; ++i)
+        table.push_back (in.read<var> ().get ());
+      int total = 0;
+      for (auto const& value : table)
+        total += value.match (weigh {}).get ();
+      keep (total);
+    });
+    run ("load", N, dist, "variant_archive", count, [&archive] () {
+      auto const table = ml::movar::variant_archive_for<var>::open (archive).get ();
+      int total = 0;
+      for (std::size_t row = 0; row != table.size (); ++row)
+        total += table[row].match (weigh {}).get ();
+      keep (total);
+    });
+  }
+} // namespace bench
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/atomic.hpp>
+#include <mutex>
+
+// Sharing variants through a slot without contention: an atomic_value against a variant guarded by a
+// mutex, storing every input and reading it back, reading an unchanging value, and swapping inputs in.
+namespace bench
+{
+  template<int N>
+  void atomic_benchmarks (distribution dist)
+  {
+    using var = movar_maybe<N>;
+
+    auto const idx = indices (N, dist);
+    auto const values = make_inputs<var, N> (idx, true);
+    std::size_t const count = idx.size ();
+
+    run ("publish", N, dist, "mutex", count, [&values] () {
+      std::mutex mutex;
+      var shared;
+      int total = 0;
+      for (auto const& value : values) {
+        {
+          std::lock_guard lock (mutex);
+          shared = value;
+        }
+        std::lock_guard lock (mutex);
+        total += shared.match (weigh {}).get ();
+      }
+      keep (total);
+    });
+    run ("publish", N, dist, "atomic_value", count, [&values] () {
+      ml::movar::atomic_value<var> shared;
+      int total = 0;
+      for (auto const& value : values) {
+        shared.store (value);
+        total += shared.load ().match (weigh {}).get ();
+      }
+      keep (total);
+    });
+
+    run ("read", N, dist, "mutex", count, [&values] () {
+      std::mutex mutex;
+      var const shared = values.front ();
+      int total = 0;
+      for (std::size_t i = 0; i != values.size (); ++i) {
+        std::lock_guard lock (mutex);
+        total += shared.match (weigh {}).get ();
+      }
+      keep (total);
+    });
+    run ("read", N, dist, "atomic_value", count, [&values] () {
+      ml::movar::atomic_value<var> const shared (values.front ());
+      int total = 0;
+      for (std::size_t i = 0; i != values.size (); ++i)
+        total += shared.load ().match (weigh {}).get ();
+      keep (total);
+    });
+
+    run ("exchange", N, dist, "mutex", count, [&values] () {
+      std::mutex mutex;
+      var shared;
+      int total = 0;
+      for (auto const& value : values) {
+        std::lock_guard lock (mutex);
+        total += std::exchange (shared, value).match (weigh {}).get ();
+      }
+      keep (total);
+    });
+    run ("exchange", N, dist, "atomic_value", count, [&values] () {
+      ml::movar::atomic_value<var> shared;
+      int total = 0;
+      for (auto const& value : values)
+        total += shared.exchange (value).match (weigh {}).get ();
+      keep (total);
+    });
+  }
+} // namespace bench
\ No newline at end of file
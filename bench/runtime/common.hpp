@@ -0,0 +1,152 @@
+#pragma once
+#include "harness.hpp"
+#include <ml/movar/movar.hpp>
+#include <ml/movar/serialize.hpp>
+#include <variant>
+
+// Alternatives and equivalent variant types shared by the runtime benchmarks.
+namespace bench
+{
+  namespace mp = boost::mp11;
+
+  template<int I>
+  struct alt
+  {
+    int value;
+
+    bool operator== (alt const&) const = default;
+    auto operator<=> (alt const&) const = default;
+  };
+
+  template<class I>
+  using alt_at = alt<I::value>;
+
+  template<int N>
+  using alts = mp::mp_transform<alt_at, mp::mp_iota_c<N>>;
+
+  template<int N>
+  using movar_variant = mp::mp_rename<alts<N>, ml::movar::variant>;
+
+  template<int N>
+  using movar_maybe = mp::mp_rename<alts<N>, ml::movar::maybe>;
+
+  template<int N>
+  using std_variant = mp::mp_rename<alts<N>, std::variant>;
+
+  template<int N>
+  using std_optional_variant = mp::mp_rename<mp::mp_push_front<alts<N>, std::monostate>, std::variant>;
+
+  // The hand-written equivalent: a tag and the payload shared by all alternatives, -1 for empty.
+  struct tagged
+  {
+    int tag;
+    int value;
+  };
+
+  // Inputs with the given active indices; every 16th input of the empty-able types is empty.
+  template<class Var, int N>
+  std::vector<Var> make_inputs (std::vector<int> const& indices, bool with_empty)
+  {
+    std::vector<Var> result;
+    result.reserve (indices.size ());
+    for (std::size_t i = 0; i < indices.size (); ++i) {
+      int const value = static_cast<int> (i);
+      if (with_empty && i % 16 == 15) {
+        if constexpr (std::same_as<Var, tagged>)
+          result.push_back (tagged {-1, value});
+        else
+          result.push_back (Var ());
+        continue;
+      }
+      mp::mp_with_index<N> (indices[i], [&] (auto I) {
+        if constexpr (std::same_as<Var, tagged>)
+          result.push_back (tagged {I, value});
+        else if constexpr (ml::movar::Variant<Var>)
+          result.push_back (Var (std::in_place_index<I>, alt<I> {value}));
+        else
+          result.push_back (Var (std::in_place_index<I + (std::variant_size_v<Var> - N)>, alt<I> {value}));
+      });
+    }
+    return result;
+  }
+
+  // An index-dependent computation on the payload.
+  struct weigh
+  {
+    template<int I>
+    int operator() (alt<I> a) const
+    {
+      return a.value * (I + 1) + I;
+    }
+
+    int operator() (ml::movar::nothing) const
+    {
+      return -1;
+    }
+
+    int operator() (std::monostate) const
+    {
+      return -1;
+    }
+  };
+
+  inline int weigh_tagged (tagged t)
+  {
+    return t.tag < 0 ? -1 : t.value * (t.tag + 1) + t.tag;
+  }
+
+#define ML_MOVAR_BENCH_CASE(I)                  \
+  case I:                                       \
+    if constexpr (I < N)                        \
+      return fn (alt<I> {t.value});             \
+    else                                        \
+      break;
+
+  // A switch over the tag, written as one would by hand for up to 32 alternatives.
+  template<int N, class Fn>
+  inline auto dispatch (tagged t, Fn&& fn)
+  {
+    static_assert (N <= 32);
+    switch (t.tag) {
+      ML_MOVAR_BENCH_CASE (0)
+      ML_MOVAR_BENCH_CASE (1)
+      ML_MOVAR_BENCH_CASE (2)
+      ML_MOVAR_BENCH_CASE (3)
+      ML_MOVAR_BENCH_CASE (4)
+      ML_MOVAR_BENCH_CASE (5)
+      ML_MOVAR_BENCH_CASE (6)
+      ML_MOVAR_BENCH_CASE (7)
+      ML_MOVAR_BENCH_CASE (8)
+      ML_MOVAR_BENCH_CASE (9)
+      ML_MOVAR_BENCH_CASE (10)
+      ML_MOVAR_BENCH_CASE (11)
+      ML_MOVAR_BENCH_CASE (12)
+      ML_MOVAR_BENCH_CASE (13)
+      ML_MOVAR_BENCH_CASE (14)
+      ML_MOVAR_BENCH_CASE (15)
+      ML_MOVAR_BENCH_CASE (16)
+      ML_MOVAR_BENCH_CASE (17)
+      ML_MOVAR_BENCH_CASE (18)
+      ML_MOVAR_BENCH_CASE (19)
+      ML_MOVAR_BENCH_CASE (20)
+      ML_MOVAR_BENCH_CASE (21)
+      ML_MOVAR_BENCH_CASE (22)
+      ML_MOVAR_BENCH_CASE (23)
+      ML_MOVAR_BENCH_CASE (24)
+      ML_MOVAR_BENCH_CASE (25)
+      ML_MOVAR_BENCH_CASE (26)
+      ML_MOVAR_BENCH_CASE (27)
+      ML_MOVAR_BENCH_CASE (28)
+      ML_MOVAR_BENCH_CASE (29)
+      ML_MOVAR_BENCH_CASE (30)
+      ML_MOVAR_BENCH_CASE (31)
+    }
+    return fn (ml::movar::nothing ());
+  }
+
+#undef ML_MOVAR_BENCH_CASE
+} // namespace bench
+
+// The alternatives hold a single int, so they are written as they are in memory.
+template<int I>
+inline constexpr bool ml::movar::enable_bitwise<bench::alt<I>> = true;
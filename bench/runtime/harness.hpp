@@ -0,0 +1,184 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ML_MOVAR_BENCH_PERF 1
+#else
+#define ML_MOVAR_BENCH_PERF 0
+#endif
+
+// Minimal runtime benchmark harness: every benchmark processes a fixed array of inputs, and reports the
+// best time per input over several runs, and the retired instructions per input when perf events are
+// available.
+namespace bench
+{
+  // Prevents the compiler from discarding @a value or the computation that produced it.
+  template<class T>
+  inline void keep (T const& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile ("" : : "r,m"(value) : "memory");
+#else
+    static volatile T const* sink;
+    sink = &value;
+#endif
+  }
+
+  // Counts the instructions retired by this thread, if the kernel allows it.
+  class instruction_counter
+  {
+  public:
+    instruction_counter ()
+    {
+#if ML_MOVAR_BENCH_PERF
+      perf_event_attr attr {};
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof (attr);
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      _fd = static_cast<int> (syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    instruction_counter (instruction_counter const&) = delete;
+    instruction_counter& operator= (instruction_counter const&) = delete;
+
+    ~instruction_counter ()
+    {
+#if ML_MOVAR_BENCH_PERF
+      if (_fd >= 0)
+        close (_fd);
+#endif
+    }
+
+    [[nodiscard]] bool available () const
+    {
+      return _fd >= 0;
+    }
+
+    void start ()
+    {
+#if ML_MOVAR_BENCH_PERF
+      if (_fd >= 0) {
+        ioctl (_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl (_fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+#endif
+    }
+
+    [[nodiscard]] std::optional<std::uint64_t> stop ()
+    {
+#if ML_MOVAR_BENCH_PERF
+      if (_fd >= 0) {
+        ioctl (_fd, PERF_EVENT_IOC_DISABLE, 0);
+        std::uint64_t count = 0;
+        if (read (_fd, &count, sizeof (count)) == sizeof (count))
+          return count;
+      }
+#endif
+      return std::nullopt;
+    }
+
+  private:
+    int _fd = -1;
+  };
+
+  // How the active alternatives of the inputs are chosen.
+  enum class distribution
+  {
+    uniform, // uniformly random, the dispatch is not predictable
+    skewed   // 90% the first alternative
+  };
+
+  inline char const* name (distribution dist)
+  {
+    return dist == distribution::uniform ? "uniform" : "skewed";
+  }
+
+  // Active indices of the inputs: @a count indices in [0, size).
+  inline std::vector<int> indices (int size, distribution dist, std::size_t count = 4096)
+  {
+    std::mt19937 engine (42);
+    std::uniform_int_distribution<int> uniform (0, size - 1);
+    std::bernoulli_distribution first (0.9);
+    std::vector<int> result (count);
+    for (auto& index : result)
+      index = (dist == distribution::skewed && first (engine)) ? 0 : uniform (engine);
+    return result;
+  }
+
+  struct options
+  {
+    int runs = 7;
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds (10);
+  };
+
+  inline options& settings ()
+  {
+    static options instance;
+    return instance;
+  }
+
+  inline void print_header ()
+  {
+    std::printf ("%-12s %6s %-8s %-16s %10s %12s\n", "operation", "size", "dist", "implementation", "ns/op",
+      "instr/op");
+  }
+
+  // Measures @a fn, which processes @a inputs inputs per call, and prints one row.
+  template<class Fn>
+  void run (char const* operation, int size, distribution dist, char const* implementation,
+    std::size_t inputs, Fn&& fn)
+  {
+    using clock = std::chrono::steady_clock;
+
+    // repeat the call until a run lasts at least min_time
+    std::size_t repeat = 1;
+    for (;;) {
+      auto const begin = clock::now ();
+      for (std::size_t i = 0; i < repeat; ++i)
+        fn ();
+      if (clock::now () - begin >= settings ().min_time || repeat >= (std::size_t (1) << 30))
+        break;
+      repeat *= 2;
+    }
+
+    instruction_counter counter;
+    double best_ns = 1e300;
+    std::optional<std::uint64_t> best_instructions;
+    for (int r = 0; r < settings ().runs; ++r) {
+      counter.start ();
+      auto const begin = clock::now ();
+      for (std::size_t i = 0; i < repeat; ++i)
+        fn ();
+      auto const end = clock::now ();
+      auto const instructions = counter.stop ();
+
+      double const ns = std::chrono::duration<double, std::nano> (end - begin).count ();
+      best_ns = std::min (best_ns, ns);
+      if (instructions && (!best_instructions || *instructions < *best_instructions))
+        best_instructions = instructions;
+    }
+
+    double const ops = double (repeat) * double (inputs);
+    if (best_instructions)
+      std::printf ("%-12s %6d %-8s %-16s %10.3f %12.2f\n", operation, size, name (dist), implementation,
+        best_ns / ops, double (*best_instructions) / ops);
+    else
+      std::printf ("%-12s %6d %-8s %-16s %10.3f %12s\n", operation, size, name (dist), implementation,
+        best_ns / ops, "-");
+  }
+} // namespace bench
@@ -0,0 +1,54 @@
+// Code size benchmark: a fork of 16 filtered branches applied to an option.
+#include <ml/movar/movar.hpp>
+#include <utility>
+
+namespace
+{
+  using ml::movar::filter;
+  using ml::movar::option;
+
+  template<int I>
+  struct tag
+  {
+    int value;
+  };
+
+  template<int I>
+  struct equals
+  {
+    bool operator() (int x) const
+    {
+      return x == I;
+    }
+  };
+
+  template<int I>
+  struct make_tag
+  {
+    tag<I> operator() (int x) const
+    {
+      return {x};
+    }
+  };
+
+  template<std::size_t... Is>
+  auto make_fork (std::index_sequence<Is...>)
+  {
+    return ((filter (equals<Is> {}) >> make_tag<Is> {}) | ...);
+  }
+
+  auto const branches = make_fork (std::make_index_sequence<16> {});
+} // namespace
+
+int run (option<int> const& value)
+{
+  return value.map (branches).map_or ([] (auto x) { return x.value; }, -1).get ();
+}
+
+int run_all (int const* values, int count)
+{
+  int total = 0;
+  for (int i = 0; i < count; ++i)
+    total += run (option<int> (values[i]));
+  return total;
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+// Code size benchmark: a lazy pipeline of 16 filtered stages applied to a variant and an option.
+#include <ml/movar/movar.hpp>
+#include <utility>
+
+namespace
+{
+  using ml::movar::either;
+  using ml::movar::filter;
+  using ml::movar::option;
+  using ml::movar::sequence;
+
+  struct positive
+  {
+    bool operator() (auto x) const
+    {
+      return x > 0;
+    }
+  };
+
+  struct decrement
+  {
+    auto operator() (auto x) const
+    {
+      return x - 1;
+    }
+  };
+
+  struct swap
+  {
+    either<int, double> operator() (int x) const
+    {
+      return static_cast<double> (x);
+    }
+
+    either<int, double> operator() (double x) const
+    {
+      return static_cast<int> (x);
+    }
+  };
+
+  template<std::size_t... Is>
+  auto make_pipeline (std::index_sequence<Is...>)
+  {
+    return (sequence () >> ... >> ((void) Is, filter (positive {}) >> decrement {} >> swap {}));
+  }
+
+  auto const stages = make_pipeline (std::make_index_sequence<16> {});
+} // namespace
+
+double run_either (either<int, double> const& value)
+{
+  return value.map (stages).map_or ([] (auto x) { return static_cast<double> (x); }, -1.0).get ();
+}
+
+double run_option (option<int> const& value)
+{
+  return value.map (stages).map_or ([] (auto x) { return static_cast<double> (x); }, -1.0).get ();
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+// Code size benchmark: visiting, mapping and comparing a large maybe and variant.
+#include <ml/movar/movar.hpp>
+#include <utility>
+
+// Named, so that the functions below have external linkage and are kept in the object file.
+namespace size_bench
+{
+  using ml::movar::maybe;
+  using ml::movar::variant;
+
+  template<int I>
+  struct alt
+  {
+    int value;
+
+    bool operator== (alt const&) const = default;
+  };
+
+  template<std::size_t... Is>
+  auto make_variant (std::index_sequence<Is...>) -> variant<alt<Is>...>;
+
+  template<std::size_t... Is>
+  auto make_maybe (std::index_sequence<Is...>) -> maybe<alt<Is>...>;
+
+  using large_variant = decltype (make_variant (std::make_index_sequence<32> {}));
+  using large_maybe = decltype (make_maybe (std::make_index_sequence<32> {}));
+} // namespace size_bench
+
+namespace
+{
+  using ml::movar::nothing;
+  using size_bench::alt;
+  using size_bench::large_maybe;
+  using size_bench::large_variant;
+
+  struct weight
+  {
+    template<int I>
+    int operator() (alt<I> x) const
+    {
+      return x.value * (I + 1);
+    }
+
+    int operator() (nothing) const
+    {
+      return -1;
+    }
+  };
+
+  struct next
+  {
+    template<int I>
+    auto operator() (alt<I> x) const
+    {
+      return alt<(I + 1) % 32> {x.value};
+    }
+  };
+} // namespace
+
+int variant_match (large_variant const& value)
+{
+  return value.match (weight {}).get ();
+}
+
+int maybe_match (large_maybe const& value)
+{
+  return value.match (weight {}).get ();
+}
+
+large_variant variant_map (large_variant const& value)
+{
+  return value.map (next {});
+}
+
+large_maybe maybe_map (large_maybe const& value)
+{
+  return value.map (next {});
+}
+
+bool variant_equal (large_variant const& lhs, large_variant const& rhs)
+{
+  return lhs == rhs;
+}
\ No newline at end of file
@@ -15,4 +15,8 @@ if (ML_MOVAR_BUILD_DOCUMENTATION)
   find_package(Doxygen 1.9.3 REQUIRED)
   CPMAddPackage(NAME doxygen-awesome-css VERSION 2.0.3 GITHUB_REPOSITORY jothepro/doxygen-awesome-css)
   CPMAddPackage(NAME mcss GITHUB_REPOSITORY mosra/m.css GIT_TAG master)
+endif()
+
+if (ML_MOVAR_BUILD_TEST)
+  find_package(Threads REQUIRED)
 endif()
\ No newline at end of file
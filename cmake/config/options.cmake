@@ -13,9 +13,12 @@ endif()
 
 option(ML_MOVAR_THROWING_CAST        "Throw on failed variant conversions" ON)
 option(ML_MOVAR_THROWING_ACCESS      "Throw on failed variant access" ON)
+option(ML_MOVAR_CANONICAL_ORDER      "Order merged alternatives by type key" OFF)
+option(ML_MOVAR_OUTLINE_COLD_PATHS   "Keep rarely taken branches out of line" OFF)
 option(ML_MOVAR_INCLUDES_WITH_SYSTEM "Disable all warnings in ml::movar headers" ${PROJECT_IS_NOT_TOP_LEVEL})
 option(ML_MOVAR_BUILD_TEST           "Build unit test for ml::movar" ${PROJECT_IS_TOP_LEVEL})
 option(ML_MOVAR_BUILD_DOCUMENTATION  "Compile doxygen documentation"  ${PROJECT_IS_TOP_LEVEL})
+option(ML_MOVAR_BUILD_BENCHMARK      "Build benchmarks for ml::movar" OFF)
 
 if (ML_MOVAR_THROWING_CAST)
   set(throwing_cast_status "ON")
@@ -29,6 +32,18 @@ else()
   set(throwing_access_status "OFF")
 endif()
 
+if(ML_MOVAR_CANONICAL_ORDER)
+  set(canonical_order_status "ON")
+else()
+  set(canonical_order_status "OFF")
+endif()
+
+if(ML_MOVAR_OUTLINE_COLD_PATHS)
+  set(outline_cold_status "ON")
+else()
+  set(outline_cold_status "OFF")
+endif()
+
 if(ML_MOVAR_INCLUDES_WITH_SYSTEM)
   set(includes_system_status "ON")
 else()
@@ -47,10 +62,19 @@ else()
   set(docs_status "OFF ")
 endif()
 
+if (ML_MOVAR_BUILD_BENCHMARK)
+  set(bench_status "ON")
+else()
+  set(bench_status "OFF ")
+endif()
+
 message(STATUS "[ml::movar] Building ${CMAKE_BUILD_TYPE} mode with: ${CMAKE_CXX_FLAGS}")
 message(STATUS "[ml::movar] Throwing conversions : ${throwing_cast_status} (via ML_MOVAR_THROWING_CAST)")
 message(STATUS "[ml::movar] Throwing access      : ${throwing_access_status} (via ML_MOVAR_THROWING_ACCESS)")
+message(STATUS "[ml::movar] Canonical ordering   : ${canonical_order_status} (via ML_MOVAR_CANONICAL_ORDER)")
+message(STATUS "[ml::movar] Outline cold paths   : ${outline_cold_status} (via ML_MOVAR_OUTLINE_COLD_PATHS)")
 message(STATUS "[ml::movar] Includes as SYSTEM   : ${includes_system_status} (via ML_MOVAR_INCLUDES_WITH_SYSTEM)")
 message(STATUS "[ml::movar] Unit tests           : ${test_status} (via ML_MOVAR_BUILD_TEST)")
 message(STATUS "[ml::movar] Docs                 : ${docs_status} (via ML_MOVAR_BUILD_DOCUMENTATION)")
+message(STATUS "[ml::movar] Benchmarks           : ${bench_status} (via ML_MOVAR_BUILD_BENCHMARK)")
 set(CMAKE_EXPORT_COMPILE_COMMANDS ON)
\ No newline at end of file
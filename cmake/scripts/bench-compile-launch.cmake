@@ -0,0 +1,22 @@
+# Compiler launcher for the compile-time benchmarks: runs the compile command given after "--" and saves
+# its diagnostics, which contain the -ftime-report output with GCC, to REPORT.
+#
+# cmake -DREPORT=<file> -P bench-compile-launch.cmake -- <compiler> <arguments>...
+
+set(command "")
+set(found_separator FALSE)
+math(EXPR last "${CMAKE_ARGC} - 1")
+foreach(index RANGE ${last})
+  if(found_separator)
+    list(APPEND command "${CMAKE_ARGV${index}}")
+  elseif(CMAKE_ARGV${index} STREQUAL "--")
+    set(found_separator TRUE)
+  endif()
+endforeach()
+
+execute_process(COMMAND ${command} RESULT_VARIABLE result OUTPUT_VARIABLE output ERROR_VARIABLE errors)
+file(WRITE "${REPORT}" "${errors}")
+
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${output}${errors}")
+endif()
@@ -0,0 +1,104 @@
+# Prints a summary table of the compile-time benchmarks listed in ENTRIES, a file generated by
+# cmake/targets/bench.cmake that sets `entries` to a list of "name|parameter|report|object" items.
+#
+# cmake -DENTRIES=<file> -DCOMPILER_ID=<id> -P bench-compile-summary.cmake
+
+include("${ENTRIES}")
+
+# Converts a decimal number of seconds to integer milliseconds.
+function(to_milliseconds seconds out)
+  if(seconds MATCHES "^([0-9]+)\\.([0-9]*)$")
+    string(SUBSTRING "${CMAKE_MATCH_2}000" 0 3 fraction)
+    math(EXPR value "${CMAKE_MATCH_1} * 1000 + 1${fraction} - 1000")
+  elseif(seconds MATCHES "^[0-9]+$")
+    math(EXPR value "${seconds} * 1000")
+  else()
+    set(value 0)
+  endif()
+  set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+# Wall time of a -ftime-report row, in milliseconds.
+function(gcc_row_time report label out)
+  set(time "[0-9.]+ *\\( *[0-9]+%\\)")
+  if(report MATCHES "${label} *: *${time} *${time} *([0-9.]+)")
+    to_milliseconds(${CMAKE_MATCH_1} value)
+  else()
+    set(value 0)
+  endif()
+  set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+# Duration in milliseconds and count of a "Total" event of a -ftime-trace file.
+function(clang_total trace name out_time out_count)
+  if(trace MATCHES "\"dur\":([0-9]+),\"name\":\"Total ${name}\",\"args\":{\"count\":([0-9]+)")
+    math(EXPR value "${CMAKE_MATCH_1} / 1000")
+    set(${out_time} ${value} PARENT_SCOPE)
+    set(${out_count} ${CMAKE_MATCH_2} PARENT_SCOPE)
+  else()
+    set(${out_time} 0 PARENT_SCOPE)
+    set(${out_count} 0 PARENT_SCOPE)
+  endif()
+endfunction()
+
+function(pad text width out)
+  string(LENGTH "${text}" length)
+  while(length LESS width)
+    string(PREPEND text " ")
+    math(EXPR length "${length} + 1")
+  endwhile()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+function(print_row)
+  set(line "")
+  foreach(cell ${ARGN})
+    pad("${cell}" 16 cell)
+    string(APPEND line "${cell}")
+  endforeach()
+  message("${line}")
+endfunction()
+
+print_row(benchmark size "frontend ms" "instantiate ms" instantiations "memory" "object bytes")
+
+foreach(entry ${entries})
+  string(REPLACE "|" ";" fields "${entry}")
+  list(GET fields 0 name)
+  list(GET fields 1 parameter)
+  list(GET fields 2 report)
+  list(GET fields 3 object)
+
+  if(NOT EXISTS "${object}")
+    print_row(${name} ${parameter} - - - - "not built")
+    continue()
+  endif()
+  file(SIZE "${object}" object_size)
+
+  set(frontend -)
+  set(instantiate -)
+  set(instantiations -)
+  set(memory -)
+
+  if(COMPILER_ID MATCHES "Clang")
+    string(REGEX REPLACE "\\.[^./]*$" ".json" trace_file "${object}")
+    if(EXISTS "${trace_file}")
+      file(READ "${trace_file}" trace)
+      clang_total("${trace}" Frontend frontend unused)
+      clang_total("${trace}" InstantiateClass class_time class_count)
+      clang_total("${trace}" InstantiateFunction function_time function_count)
+      math(EXPR instantiate "${class_time} + ${function_time}")
+      math(EXPR instantiations "${class_count} + ${function_count}")
+    endif()
+  elseif(EXISTS "${report}")
+    file(READ "${report}" text)
+    gcc_row_time("${text}" "phase parsing" parsing)
+    gcc_row_time("${text}" "phase lang. deferred" deferred)
+    gcc_row_time("${text}" "template instantiation" instantiate)
+    math(EXPR frontend "${parsing} + ${deferred}")
+    if(text MATCHES "TOTAL *: *[0-9.]+ +[0-9.]+ +[0-9.]+ +([0-9]+[kMG]?)")
+      set(memory ${CMAKE_MATCH_1})
+    endif()
+  endif()
+
+  print_row(${name} ${parameter} ${frontend} ${instantiate} ${instantiations} ${memory} ${object_size})
+endforeach()
@@ -0,0 +1,110 @@
+# Prints the code size of the objects listed in ENTRIES, a file generated by cmake/targets/bench.cmake that
+# sets `entries` to a list of "name|config|object" items, and compares it with BASELINE.
+#
+# The size of an object is the text column of `size`; the size of a function is its `nm --size-sort` size,
+# for every global function of the object. The full `nm` listing of each object is saved to REPORTS.
+# Fails if the size of an object exceeds its baseline by more than TOLERANCE percent. With UPDATE, writes
+# the measured sizes to BASELINE instead.
+#
+# cmake -DENTRIES=<file> -DNM=<nm> -DSIZE=<size> -DREPORTS=<dir> -DBASELINE=<file> -DTOLERANCE=<percent>
+#   [-DUPDATE=ON] -P bench-size-summary.cmake
+
+include("${ENTRIES}")
+
+if(NOT SIZE OR NOT NM)
+  message(FATAL_ERROR "bench-size needs both nm and size")
+endif()
+
+function(pad text width out)
+  string(LENGTH "${text}" length)
+  while(length LESS width)
+    string(PREPEND text " ")
+    math(EXPR length "${length} + 1")
+  endwhile()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+function(print_row)
+  set(line "")
+  foreach(cell ${ARGN})
+    pad("${cell}" 16 cell)
+    string(APPEND line "${cell}")
+  endforeach()
+  message("${line}")
+endfunction()
+
+# Baseline lines are "name|config|symbol|bytes", where symbol is .text for the whole object.
+set(baseline "")
+if(EXISTS "${BASELINE}" AND NOT UPDATE)
+  file(STRINGS "${BASELINE}" baseline)
+endif()
+
+function(baseline_size key out)
+  set(value -)
+  foreach(line ${baseline})
+    if(line MATCHES "^${key}\\|([0-9]+)$")
+      set(value ${CMAKE_MATCH_1})
+    endif()
+  endforeach()
+  set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+set(measured "")
+set(regressions "")
+
+print_row(benchmark config function bytes baseline delta)
+
+foreach(entry ${entries})
+  string(REPLACE "|" ";" fields "${entry}")
+  list(GET fields 0 name)
+  list(GET fields 1 config)
+  list(GET fields 2 object)
+
+  if(NOT EXISTS "${object}")
+    print_row(${name} ${config} - "not built")
+    continue()
+  endif()
+
+  execute_process(COMMAND ${SIZE} "${object}" OUTPUT_VARIABLE size_output)
+  if(NOT size_output MATCHES "\n *([0-9]+)")
+    message(FATAL_ERROR "Cannot read the size of ${object}")
+  endif()
+  set(rows ".text|${CMAKE_MATCH_1}")
+
+  execute_process(COMMAND ${NM} --size-sort --defined-only -t d -C "${object}" OUTPUT_VARIABLE symbols)
+  file(WRITE "${REPORTS}/size-${name}-${config}.txt" "${symbols}")
+  string(REGEX MATCHALL "[0-9]+ T [A-Za-z_0-9:]+\\(" functions "${symbols}")
+  foreach(function ${functions})
+    string(REGEX MATCH "^0*([0-9]+) T ([A-Za-z_0-9:]+)" unused "${function}")
+    list(APPEND rows "${CMAKE_MATCH_2}|${CMAKE_MATCH_1}")
+  endforeach()
+
+  foreach(row ${rows})
+    string(REPLACE "|" ";" cells "${row}")
+    list(GET cells 0 symbol)
+    list(GET cells 1 bytes)
+    string(APPEND measured "${name}|${config}|${symbol}|${bytes}\n")
+
+    baseline_size("${name}\\|${config}\\|${symbol}" reference)
+    if(reference STREQUAL "-")
+      set(delta -)
+    else()
+      math(EXPR delta "${bytes} - ${reference}")
+      if(symbol STREQUAL ".text" AND bytes GREATER reference)
+        math(EXPR limit "${reference} + ${reference} * ${TOLERANCE} / 100")
+        if(bytes GREATER limit)
+          list(APPEND regressions "${name} ${config}: ${reference} -> ${bytes} bytes")
+        endif()
+      endif()
+    endif()
+    print_row(${name} ${config} ${symbol} ${bytes} ${reference} ${delta})
+  endforeach()
+endforeach()
+
+if(UPDATE)
+  file(WRITE "${BASELINE}" "${measured}")
+  message("Baseline written to ${BASELINE}")
+elseif(regressions)
+  string(REPLACE ";" "\n  " regressions "${regressions}")
+  message(FATAL_ERROR "Code size grew by more than ${TOLERANCE}%:\n  ${regressions}")
+endif()
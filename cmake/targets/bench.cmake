@@ -0,0 +1,134 @@
+# =================================================================================================
+# Compile-time benchmarks: every source in bench/compile is compiled for a series of sizes, with
+# -ftime-trace (Clang) or -ftime-report (GCC). Building bench-compile prints a summary table;
+# use --clean-first to measure again.
+# =================================================================================================
+
+set(ML_MOVAR_BENCH_ALTERNATIVES 8 16 32 64 128 256)
+set(ML_MOVAR_BENCH_DEPTHS 4 8 16 32 64)
+set(ML_MOVAR_BENCH_WIDTHS 2 4 8 16 32)
+
+if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+  set(bench_report_option -ftime-trace)
+elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+  set(bench_report_option -ftime-report)
+else()
+  set(bench_report_option "")
+endif()
+
+set(bench_reports ${CMAKE_CURRENT_BINARY_DIR}/bench-compile)
+set(bench_entries "")
+
+# Adds the object library bench-compile-<name>-<value>, compiling bench/compile/<name>.cpp with
+# <definition>=<value>.
+function(ml_movar_add_compile_bench name definition value)
+  set(target bench-compile-${name}-${value})
+  set(report ${bench_reports}/${name}-${value}.txt)
+
+  add_library(${target} OBJECT EXCLUDE_FROM_ALL bench/compile/${name}.cpp)
+  target_link_libraries(${target} PRIVATE ml::movar)
+  target_compile_definitions(${target} PRIVATE ${definition}=${value})
+  target_compile_options(${target} PRIVATE ${bench_report_option})
+  set_target_properties(${target} PROPERTIES RULE_LAUNCH_COMPILE
+    "${CMAKE_COMMAND} -DREPORT=${report} -P ${PROJECT_SOURCE_DIR}/cmake/scripts/bench-compile-launch.cmake --")
+
+  add_dependencies(bench-compile-objects ${target})
+  set(bench_entries "${bench_entries}list(APPEND entries \"${name}|${value}|${report}|$<TARGET_OBJECTS:${target}>\")\n"
+    PARENT_SCOPE)
+endfunction()
+
+file(MAKE_DIRECTORY ${bench_reports})
+add_custom_target(bench-compile-objects)
+
+foreach(value ${ML_MOVAR_BENCH_ALTERNATIVES})
+  ml_movar_add_compile_bench(alternatives ML_MOVAR_BENCH_ALTERNATIVES ${value})
+endforeach()
+
+foreach(value ${ML_MOVAR_BENCH_DEPTHS})
+  ml_movar_add_compile_bench(pipeline ML_MOVAR_BENCH_DEPTH ${value})
+endforeach()
+
+foreach(value ${ML_MOVAR_BENCH_WIDTHS})
+  ml_movar_add_compile_bench(fork ML_MOVAR_BENCH_WIDTH ${value})
+endforeach()
+
+file(GENERATE OUTPUT ${bench_reports}/entries.cmake CONTENT "${bench_entries}")
+
+add_custom_target(bench-compile
+  COMMAND ${CMAKE_COMMAND} -DENTRIES=${bench_reports}/entries.cmake -DCOMPILER_ID=${CMAKE_CXX_COMPILER_ID}
+    -P ${PROJECT_SOURCE_DIR}/cmake/scripts/bench-compile-summary.cmake
+  DEPENDS bench-compile-objects
+  VERBATIM)
+
+# =================================================================================================
+# Runtime benchmarks: movar against std::variant + std::visit and hand-written switches. Configure with
+# CMAKE_BUILD_TYPE=Release and run the bench executable.
+# =================================================================================================
+
+add_executable(bench bench/runtime/00-main.cpp)
+target_link_libraries(bench PRIVATE ml::movar)
+target_include_directories(bench PRIVATE bench/runtime)
+
+
+# =================================================================================================
+# Code size benchmarks: every source in bench/size is compiled at -O2 and -O3, with and without
+# ML_MOVAR_OUTLINE_COLD_PATHS. Building bench-size prints the .text size of each object and of its
+# exported functions, and fails if an object grew by more than ML_MOVAR_BENCH_SIZE_TOLERANCE percent
+# over bench/size/baseline-<compiler>.txt. Building bench-size-baseline rewrites the baseline.
+# =================================================================================================
+
+set(ML_MOVAR_BENCH_SIZE_SOURCES variant pipeline fork)
+set(ML_MOVAR_BENCH_SIZE_TOLERANCE 5 CACHE STRING "Allowed .text growth over the size baseline, in percent")
+
+find_program(ML_MOVAR_SIZE_TOOL NAMES size llvm-size)
+
+set(bench_size_entries "")
+
+# Adds the object library bench-size-<name>-<config>, compiling bench/size/<name>.cpp with the given
+# optimization level and, if outline is TRUE, with ML_MOVAR_OUTLINE_COLD_PATHS.
+function(ml_movar_add_size_bench name level outline)
+  if(outline)
+    set(config ${level}-outline)
+  else()
+    set(config ${level})
+  endif()
+  set(target bench-size-${name}-${config})
+
+  add_library(${target} OBJECT EXCLUDE_FROM_ALL bench/size/${name}.cpp)
+  target_link_libraries(${target} PRIVATE ml::movar)
+  target_compile_options(${target} PRIVATE -${level})
+  target_compile_definitions(${target} PRIVATE NDEBUG)
+  if(outline)
+    target_compile_definitions(${target} PRIVATE ML_MOVAR_OUTLINE_COLD_PATHS=1)
+  endif()
+
+  add_dependencies(bench-size-objects ${target})
+  set(bench_size_entries "${bench_size_entries}list(APPEND entries \"${name}|${config}|$<TARGET_OBJECTS:${target}>\")\n"
+    PARENT_SCOPE)
+endfunction()
+
+add_custom_target(bench-size-objects)
+
+foreach(name ${ML_MOVAR_BENCH_SIZE_SOURCES})
+  foreach(level O2 O3)
+    ml_movar_add_size_bench(${name} ${level} FALSE)
+    ml_movar_add_size_bench(${name} ${level} TRUE)
+  endforeach()
+endforeach()
+
+file(GENERATE OUTPUT ${bench_reports}/size-entries.cmake CONTENT "${bench_size_entries}")
+
+set(bench_size_command ${CMAKE_COMMAND} -DENTRIES=${bench_reports}/size-entries.cmake
+  -DNM=${CMAKE_NM} -DSIZE=${ML_MOVAR_SIZE_TOOL} -DREPORTS=${bench_reports}
+  -DBASELINE=${PROJECT_SOURCE_DIR}/bench/size/baseline-${CMAKE_CXX_COMPILER_ID}.txt
+  -DTOLERANCE=${ML_MOVAR_BENCH_SIZE_TOLERANCE})
+
+add_custom_target(bench-size
+  COMMAND ${bench_size_command} -P ${PROJECT_SOURCE_DIR}/cmake/scripts/bench-size-summary.cmake
+  DEPENDS bench-size-objects
+  VERBATIM)
+
+add_custom_target(bench-size-baseline
+  COMMAND ${bench_size_command} -DUPDATE=ON -P ${PROJECT_SOURCE_DIR}/cmake/scripts/bench-size-summary.cmake
+  DEPENDS bench-size-objects
+  VERBATIM)
@@ -4,6 +4,7 @@
 get_target_property(public_include_dir ml::movar INTERFACE_INCLUDE_DIRECTORIES)
 file(GLOB_RECURSE headers CONFIGURE_DEPENDS "${public_include_dir}/ml/movar/internal/pipe/*.hpp"
   "${public_include_dir}/ml/movar/internal/type/*.hpp"
+  "${public_include_dir}/ml/movar/internal/stream/*.hpp"
   "${public_include_dir}/ml/movar/movar.hpp")
 string(REPLACE ";" " " headers_space_separated "${headers}")
 
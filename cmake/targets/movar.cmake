@@ -19,4 +19,12 @@ if(ML_MOVAR_THROWING_ACCESS)
   target_compile_definitions(ml-movar INTERFACE -DML_MOVAR_THROWING_ACCESS=1)
 else()
   target_compile_definitions(ml-movar INTERFACE -DML_MOVAR_THROWING_ACCESS=0)
+endif()
+
+if(ML_MOVAR_CANONICAL_ORDER)
+  target_compile_definitions(ml-movar INTERFACE -DML_MOVAR_CANONICAL_ORDER=1)
+endif()
+
+if(ML_MOVAR_OUTLINE_COLD_PATHS)
+  target_compile_definitions(ml-movar INTERFACE -DML_MOVAR_OUTLINE_COLD_PATHS=1)
 endif()
\ No newline at end of file
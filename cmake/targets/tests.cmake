@@ -1,4 +1,20 @@
-add_executable(driver unit/00-driver.cpp)
-target_link_libraries(driver PRIVATE ml::movar doctest::doctest)
+add_executable(driver unit/00-driver.cpp unit/00-allocations.cpp)
+target_link_libraries(driver PRIVATE ml::movar doctest::doctest Threads::Threads)
 target_include_directories(driver PRIVATE unit)
-target_compile_definitions(driver PRIVATE DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN)
\ No newline at end of file
+target_compile_definitions(driver PRIVATE DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN)
+
+add_executable(driver-noexcept unit/00-driver-noexcept.cpp unit/00-allocations.cpp)
+target_link_libraries(driver-noexcept PRIVATE ml::movar doctest::doctest Threads::Threads)
+target_include_directories(driver-noexcept PRIVATE unit)
+target_compile_definitions(driver-noexcept PRIVATE DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN DOCTEST_CONFIG_NO_EXCEPTIONS)
+if(MSVC)
+  target_compile_options(driver-noexcept PRIVATE /EHs-c-)
+else()
+  target_compile_options(driver-noexcept PRIVATE -fno-exceptions)
+endif()
+
+
+add_executable(driver-canonical unit/00-driver.cpp unit/00-allocations.cpp)
+target_link_libraries(driver-canonical PRIVATE ml::movar doctest::doctest Threads::Threads)
+target_include_directories(driver-canonical PRIVATE unit)
+target_compile_definitions(driver-canonical PRIVATE DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN ML_MOVAR_CANONICAL_ORDER=1)
@@ -0,0 +1,3 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <ml/movar/internal/atomic/atomic_value.hpp>
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <ml/movar/internal/container/flat_variant.hpp>
+#include <ml/movar/internal/container/partition.hpp>
+#include <ml/movar/internal/container/variant_collection.hpp>
+#include <ml/movar/internal/container/variant_column.hpp>
+#include <ml/movar/internal/container/variant_map.hpp>
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 #include <ml/movar/internal/algorithm/cast.hpp>
+#include <ml/movar/internal/algorithm/compare.hpp>
+#include <ml/movar/internal/algorithm/flatten.hpp>
+#include <ml/movar/internal/algorithm/fuse.hpp>
+#include <ml/movar/internal/algorithm/hash.hpp>
 #include <ml/movar/internal/algorithm/take.hpp>
 #include <ml/movar/internal/algorithm/visit.hpp>
 #include <ml/movar/internal/algorithm/wrap.hpp>
@@ -10,3 +14,4 @@
 #include <ml/movar/internal/algorithm/match.hpp>
 #include <ml/movar/internal/algorithm/or_else.hpp>
 #include <ml/movar/internal/algorithm/pipe.hpp>
+#include <ml/movar/internal/algorithm/static.hpp>
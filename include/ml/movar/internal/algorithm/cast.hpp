@@ -1,12 +1,5 @@
 #pragma once
 #include <ml/movar/internal/type/nothing.hpp>
-#include <stdexcept>
-
-#ifdef __GNUC__
-#  define ML_MOVAR_UNREACHABLE __builtin_unreachable ()
-#else
-#  define ML_MOVAR_UNREACHABLE __assume (false)
-#endif
 
 namespace ml::internal::movar
 {
@@ -19,16 +12,66 @@ namespace ml::internal::movar
     using unqual_from = remove_cvref_t<From>;
     constexpr bool can_fail = (Maybe<unqual_from> && Some<To>);
 
-    auto const visitor = []<class X> (X&& value) -> To {
-      constexpr bool is_none = None<remove_cvref_t<X>>;
-      if constexpr (is_none && can_fail) {
-        if constexpr (ML_MOVAR_THROWING_CAST)
-          throw std::runtime_error ("Bad variant cast");
-        ML_MOVAR_UNREACHABLE;
-      } else {
-        return To (std::forward<X> (value));
+    if constexpr (can_remap_cast<unqual_from, To>) {
+      // Fast path: the active alternative is constructed directly at its index in To.
+      if constexpr (Maybe<unqual_from>) {
+        if (from.is_nothing ()) {
+          if constexpr (can_fail)
+            bad_cast ();
+          else
+            return To (nothing ());
+        }
       }
-    };
-    return impl::visit (visitor, std::forward<From> (from));
+      return boost::mp11::mp_with_index<size<unqual_from>> (from.index (), [&] (auto I) -> To {
+        constexpr long J = cast_index_map<unqual_from, To>[I];
+        return To (std::in_place_index<J>, std::forward<From> (from).template get_unchecked<I> ());
+      });
+    } else {
+      auto const visitor = []<class X> (X&& value) -> To {
+        constexpr bool is_none = None<remove_cvref_t<X>>;
+        if constexpr (is_none && can_fail) {
+          bad_cast ();
+        } else {
+          return To (std::forward<X> (value));
+        }
+      };
+      return impl::visit (visitor, std::forward<From> (from));
+    }
+  }
+
+  template<class To, int..., class From>
+  static constexpr option<To> impl::try_cast (From&& from)
+  {
+    using unqual_from = remove_cvref_t<From>;
+    if constexpr (None<unqual_from>) {
+      if constexpr (Maybe<To>)
+        return option<To> (std::in_place_index<0>, nothing ());
+      else
+        return option<To> ();
+    } else {
+      if constexpr (Maybe<unqual_from> && Some<To>)
+        if (from.is_nothing ())
+          return option<To> ();
+      return option<To> (std::in_place_index<0>, impl::cast<To> (std::forward<From> (from)));
+    }
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*!
+   * @brief Converts @a from to @a To without throwing
+   * @return the converted value, or ml::movar::nothing if @a from is empty and @a To cannot be empty
+   *
+   * Unlike the explicit conversion constructors, a failed narrowing conversion (e.g. from an empty
+   * ml::movar::maybe to ml::movar::variant) is reported through the result instead of
+   * ML_MOVAR_THROWING_CAST.
+   */
+  template<Variant To, class From>
+    requires (Variant<std::remove_cvref_t<From>>
+      && (None<std::remove_cvref_t<From>> || internal::movar::can_explicit_cast<From, To>))
+  [[nodiscard]] constexpr option<To> try_cast (From&& from)
+  {
+    return internal::movar::impl::try_cast<To> (std::forward<From> (from));
   }
-} // namespace ml::internal::movar
\ No newline at end of file
+} // namespace ml::movar
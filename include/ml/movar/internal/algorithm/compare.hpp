@@ -0,0 +1,77 @@
+#pragma once
+#include <ml/movar/internal/type/type.hpp>
+
+namespace ml::internal::movar
+{
+  // Orders by index, with nothing first, and by value within an index. The alternatives are only
+  // dispatched on when both indices are equal.
+  template<Variant Var>
+  constexpr bool index_first_less (Var const& lhs, Var const& rhs)
+  {
+    if constexpr (None<Var>) {
+      return false;
+    } else {
+      if (lhs.index () != rhs.index ())
+        return lhs.index () < rhs.index ();
+      if constexpr (Maybe<Var>)
+        if (lhs.is_nothing ())
+          return false;
+      return boost::mp11::mp_with_index<size<Var>> (lhs.index (), [&lhs, &rhs] (auto I) -> bool {
+        return lhs.template get_unchecked<I> () < rhs.template get_unchecked<I> ();
+      });
+    }
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::index_first_less
+   * @brief Transparent strict weak order for @a Var that compares indices before values.
+   * @ingroup Variant
+   *
+   * Orders like the comparison operators of @a Var: nothing first, then by index, then by the value of
+   * the active alternative. Operands with different indices are ordered without visiting them, and
+   * operands with the same index are visited once. A bare alternative value compares like a @a Var
+   * holding it.
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var>)
+  struct index_first_less
+  {
+    using is_transparent = void;
+
+    /*!
+     * @return true if @a lhs precedes @a rhs
+     */
+    [[nodiscard]] constexpr bool operator() (Var const& lhs, Var const& rhs) const
+    {
+      return internal::movar::index_first_less (lhs, rhs);
+    }
+
+    /*!
+     * @return true if @a lhs precedes a @a Var holding @a rhs
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T> && !std::same_as<T, Var>)
+    [[nodiscard]] constexpr bool operator() (Var const& lhs, T const& rhs) const
+    {
+      constexpr long index = internal::movar::alternative_index<Var, T>;
+      if (lhs.index () != index)
+        return lhs.index () < index;
+      return lhs.template get_unchecked<index> () < rhs;
+    }
+
+    /*!
+     * @return true if a @a Var holding @a lhs precedes @a rhs
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T> && !std::same_as<T, Var>)
+    [[nodiscard]] constexpr bool operator() (T const& lhs, Var const& rhs) const
+    {
+      constexpr long index = internal::movar::alternative_index<Var, T>;
+      if (index != rhs.index ())
+        return index < rhs.index ();
+      return lhs < rhs.template get_unchecked<index> ();
+    }
+  };
+} // namespace ml::movar
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+#include <ml/movar/internal/type/nothing.hpp>
+
+namespace ml::internal::movar
+{
+  // The leaf at flat index K of var, reached through unchecked getters. It names the argument types of
+  // a deep visitor, and is passed the same way by _deep_visit.
+  template<long K, class Var>
+  static constexpr decltype (auto) _get_leaf (Var&& var)
+  {
+    using unqual = remove_cvref_t<Var>;
+    if constexpr (!Variant<unqual>) {
+      return std::forward<Var> (var);
+    } else if constexpr ((Maybe<unqual> || None<unqual>) && K == 0) {
+      return nothing ();
+    } else {
+      constexpr long I = leaf_owner<unqual, K>;
+      return _get_leaf<K - leaf_offset<unqual, I>> (std::forward<Var> (var).template get_unchecked<I> ());
+    }
+  }
+
+  template<class Var, class K>
+  using leaf_arg = decltype (_get_leaf<K::value> (std::declval<Var> ()));
+
+  template<class Var>
+  using leaf_args = mp_transform<mp_bind_front<leaf_arg, Var>::template fn, //
+    boost::mp11::mp_iota_c<leaf_count<remove_cvref_t<Var>>>>;
+
+  template<class Fn, class Var>
+  constexpr inline bool deep_visitor = [] () -> bool {
+    auto helper = []<class... Args> (mp_list<Args...>)
+    {
+      return (WrapInvocable<Fn, Args> && ...);
+    };
+    return helper (leaf_args<Var> {});
+  }();
+
+  template<class Fn, class Var>
+  concept DeepVisitor = deep_visitor<Fn, Var>;
+
+  template<class Var, class Fn>
+  using deep_match_result_t = simplify<mp_apply<join, //
+    mp_transform<mp_bind_front<wrap_invoke_result, Fn>::template fn, leaf_args<Var>>>>;
+
+  // Walks down to the active leaf of var, dispatching once on the index of each nested variant, and
+  // invokes fn there. The result is built directly as R instead of being joined level by level.
+  template<class R, class Var, class Fn>
+  static constexpr R _deep_visit (Var&& var, Fn&& fn)
+  {
+    using unqual = remove_cvref_t<Var>;
+    if constexpr (!Variant<unqual>) {
+      return impl::wrap_invoke_r<R> (std::forward<Fn> (fn), std::forward<Var> (var));
+    } else if constexpr (None<unqual>) {
+      return impl::wrap_invoke_r<R> (std::forward<Fn> (fn), nothing ());
+    } else {
+      if constexpr (Maybe<unqual>)
+        if (var.is_nothing ())
+          return impl::wrap_invoke_r<R> (std::forward<Fn> (fn), nothing ());
+      return boost::mp11::mp_with_index<size<unqual>> (var.index (), [&] (auto I) -> R {
+        return _deep_visit<R> (std::forward<Var> (var).template get_unchecked<I> (), std::forward<Fn> (fn));
+      });
+    }
+  }
+
+  template<class Var, class Fn>
+  static constexpr auto impl::deep_match (Var&& var, Fn&& fn)
+  {
+    return _deep_visit<deep_match_result_t<Var, Fn>> (std::forward<Var> (var), std::forward<Fn> (fn));
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*!
+   * @brief Invokes @a fn with the active leaf of @a var
+   * @return the result of @a fn, as ml::movar::Variant::match would
+   *
+   * Nested variants are treated as one flat set of alternatives, see ml::movar::flatten_t.
+   * The active leaf is reached with one dispatch per nesting level, as with nested calls to match, and
+   * @a fn is invoked there once. Its result is converted directly to the flat result type instead of
+   * being joined at every level. @a fn must be invocable with every leaf, including ml::movar::nothing
+   * if any nested variant can be empty.
+   */
+  template<class Var, class Fn>
+    requires (Variant<std::remove_cvref_t<Var>> && internal::movar::DeepVisitor<Fn, Var>)
+  constexpr auto deep_match (Var&& var, Fn fn)
+  {
+    return internal::movar::impl::deep_match (std::forward<Var> (var), std::move (fn));
+  }
+
+  /*!
+   * @brief Converts @a var to its flattened type ml::movar::flatten_t
+   * @return the active leaf of @a var, stored directly in the flattened variant
+   */
+  template<class Var>
+    requires (Variant<std::remove_cvref_t<Var>>)
+  [[nodiscard]] constexpr flatten_t<std::remove_cvref_t<Var>> flatten (Var&& var)
+  {
+    return internal::movar::impl::deep_match (std::forward<Var> (var), std::identity {});
+  }
+} // namespace ml::movar
\ No newline at end of file
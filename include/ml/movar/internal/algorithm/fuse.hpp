@@ -0,0 +1,101 @@
+#pragma once
+#include <ml/movar/internal/type/nothing.hpp>
+
+namespace ml::internal::movar
+{
+  /*
+   * Conjunction of two filter predicates, produced when two filters are piped one after the other.
+   */
+  template<std::move_constructible P1, std::move_constructible P2>
+  struct all_of
+  {
+    P1 _first;
+    P2 _second;
+
+    constexpr all_of (P1 first, P2 second)                                                           //
+      noexcept (std::is_nothrow_move_constructible_v<P1>&& std::is_nothrow_move_constructible_v<P2>) //
+      : _first (std::move (first))
+      , _second (std::move (second))
+    {}
+
+    template<class Arg>
+    [[nodiscard]] constexpr bool operator() (Arg& arg) const                                     //
+      noexcept (std::is_nothrow_invocable_v<P1 const&, Arg&>&& std::is_nothrow_invocable_v<P2 const&, Arg&>) //
+      requires (std::predicate<P1 const&, Arg&> && std::predicate<P2 const&, Arg&>)
+    {
+      return std::invoke (_first, arg) && std::invoke (_second, arg);
+    }
+  };
+
+  /*
+   * Two pipeline stages fused into one, equivalent to ml::movar::sequence<F, G>.
+   *
+   * When the first stage returns a plain value, the second stage is invoked on it directly instead of
+   * wrapping it in ml::movar::just and visiting it. A leading ml::movar::sequence<> is skipped entirely for
+   * arguments that are not variants, and an lvalue argument is passed to the second stage as const.
+   * It is kept in the pipeline because it maps the next stages over the alternatives of a variant
+   * argument. An ml::movar::sequence<> after another stage changes nothing and is dropped by impl::fuse.
+   */
+  template<std::move_constructible F, std::move_constructible G>
+  struct compose
+  {
+    F _first;
+    G _second;
+
+    constexpr compose (F first, G second)                                                          //
+      noexcept (std::is_nothrow_move_constructible_v<F>&& std::is_nothrow_move_constructible_v<G>) //
+      : _first (std::move (first))
+      , _second (std::move (second))
+    {}
+
+    template<class Arg>
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const //
+      requires (WrapInvocable<F const&, pipeline_arg<Arg>>
+        && WeakVisitor<G const&, wrap_invoke_result<F const&, pipeline_arg<Arg>>>)
+    {
+      using raw = invoke_result_t<F const&, pipeline_arg<Arg>>;
+      if constexpr (is_static_variant<remove_cvref_t<Arg>>) {
+        return (*this) (impl::unwrap_static (std::forward<Arg> (arg)));
+      } else if constexpr (same_as<F, sequence<>> && !Variant<remove_cvref_t<Arg>>) {
+        // an lvalue argument is read-only to the second stage, which cannot tell it from the copy wrapped
+        // in ml::movar::just by the unfused sequence
+        if constexpr (!std::is_lvalue_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>)
+          return impl::wrap_invoke (_second, std::forward<Arg> (arg));
+        else if constexpr (invocable<G const&, remove_cvref_t<Arg> const&>)
+          return impl::wrap_invoke (_second, std::as_const (arg));
+        else
+          return impl::wrap_invoke (_second, remove_cvref_t<Arg> (arg));
+      } else if constexpr (Variant<remove_cvref_t<raw>> || is_void_v<raw> || same_as<F, sequence<>>) {
+        return impl::wrap_invoke (_first, std::forward<Arg> (arg)).map (_second);
+      } else if constexpr (std::is_reference_v<raw>) {
+        return impl::wrap_invoke (_second, remove_cvref_t<raw> (std::invoke (_first, std::forward<Arg> (arg))));
+      } else {
+        return impl::wrap_invoke (_second, std::invoke (_first, std::forward<Arg> (arg)));
+      }
+    }
+  };
+
+  template<class F, class G>
+  compose (F, G) -> compose<F, G>;
+
+  template<class P1, class P2>
+  all_of (P1, P2) -> all_of<P1, P2>;
+
+  template<class Lhs, class Rhs>
+  static constexpr auto impl::fuse (Lhs&& lhs, Rhs&& rhs)
+  {
+    using lhs_type = remove_cvref_t<Lhs>;
+    using rhs_type = remove_cvref_t<Rhs>;
+    if constexpr (same_as<rhs_type, ml::movar::sequence<>>) {
+      // the identity stage after another stage, whose result is already wrapped
+      return std::forward<Lhs> (lhs);
+    } else if constexpr (is_filter<lhs_type> && is_filter<rhs_type>) {
+      return ml::movar::filter (all_of (std::forward<Lhs> (lhs)._pred, std::forward<Rhs> (rhs)._pred));
+    } else if constexpr (is_compose<lhs_type>) {
+      return compose (std::forward<Lhs> (lhs)._first, //
+        impl::fuse (std::forward<Lhs> (lhs)._second, std::forward<Rhs> (rhs)));
+    } else {
+      return compose (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs));
+    }
+  }
+} // namespace ml::internal::movar
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+#include <ml/movar/internal/type/type.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ml::internal::movar
+{
+  template<class T>
+  constexpr inline bool hashable = requires (std::hash<remove_cvref_t<T>> hash, remove_cvref_t<T> const& value) {
+    { hash (value) } -> std::convertible_to<std::size_t>;
+  };
+
+  template<class T>
+  using is_hashable = mp_bool<hashable<T>>;
+
+  template<class T>
+  concept HashableVariant = Variant<T> && mp_all_of<alternatives<T>, is_hashable>::value;
+
+  // Combines the index of an alternative with the hash of its value. The result goes through the
+  // finalizer of MurmurHash3, so that identity hashes such as std::hash<int> spread over all bits.
+  constexpr std::size_t hash_mix (long index, std::size_t hash) noexcept
+  {
+    auto h = static_cast<std::uint64_t> (hash) ^ static_cast<std::uint64_t> (index + 1) * 0x9e3779b97f4a7c15;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return static_cast<std::size_t> (h);
+  }
+
+  template<long Index, class T>
+  constexpr std::size_t hash_alternative (T const& value)
+  {
+    return hash_mix (Index, std::hash<remove_cvref_t<T>> {}(value));
+  }
+
+  // Hashes the active alternative with a single dispatch on the index.
+  template<Variant Var>
+  constexpr std::size_t hash_value (Var const& var)
+  {
+    if constexpr (None<Var>) {
+      return hash_mix (-1, 0);
+    } else {
+      if constexpr (Maybe<Var>)
+        if (var.is_nothing ())
+          return hash_mix (-1, 0);
+      return boost::mp11::mp_with_index<size<Var>> (var.index (), [&var] (auto I) {
+        return hash_alternative<I> (var.template get_unchecked<I> ());
+      });
+    }
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::variant_hash
+   * @brief Transparent hash function for @a Var.
+   * @ingroup Variant
+   *
+   * Hashes a variant and a bare alternative value to the same result when the variant holds that value,
+   * so that hash containers keyed by @a Var can be searched without constructing a variant.
+   * std::hash<Var> is the same function.
+   */
+  template<class Var>
+    requires (internal::movar::HashableVariant<Var>)
+  struct variant_hash
+  {
+    using is_transparent = void;
+
+    /*!
+     * @return the hash of the active alternative combined with its index
+     */
+    [[nodiscard]] constexpr std::size_t operator() (Var const& var) const
+    {
+      return internal::movar::hash_value (var);
+    }
+
+    /*!
+     * @return the hash of a @a Var holding @a value
+     * @tparam T must be an alternative of @a Var
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T> && !std::same_as<T, Var>)
+    [[nodiscard]] constexpr std::size_t operator() (T const& value) const
+    {
+      return internal::movar::hash_alternative<internal::movar::alternative_index<Var, T>> (value);
+    }
+  };
+
+  /*! @class ml::movar::variant_equal
+   * @brief Transparent equality for @a Var.
+   * @ingroup Variant
+   *
+   * Compares variants with each other and with bare alternative values. Companion of
+   * ml::movar::variant_hash.
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var>)
+  struct variant_equal
+  {
+    using is_transparent = void;
+
+    /*!
+     * @return lhs == rhs
+     */
+    [[nodiscard]] constexpr bool operator() (Var const& lhs, Var const& rhs) const
+    {
+      return lhs == rhs;
+    }
+
+    /*!
+     * @return true if @a var holds @a value
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T> && !std::same_as<T, Var>)
+    [[nodiscard]] constexpr bool operator() (Var const& var, T const& value) const
+    {
+      return var.template is<internal::movar::alternative_index<Var, T>> ()
+        && var.template get_unchecked<internal::movar::alternative_index<Var, T>> () == value;
+    }
+
+    /*!
+     * @return true if @a var holds @a value
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T> && !std::same_as<T, Var>)
+    [[nodiscard]] constexpr bool operator() (T const& value, Var const& var) const
+    {
+      return (*this) (var, value);
+    }
+  };
+} // namespace ml::movar
+
+template<>
+struct std::hash<ml::movar::nothing>
+{
+  [[nodiscard]] constexpr std::size_t operator() (ml::movar::nothing const& var) const noexcept
+  {
+    return ml::internal::movar::hash_value (var);
+  }
+};
+
+template<class T>
+  requires (ml::internal::movar::hashable<T>)
+struct std::hash<ml::movar::just<T>> : ml::movar::variant_hash<ml::movar::just<T>>
+{};
+
+template<class T>
+  requires (ml::internal::movar::hashable<T>)
+struct std::hash<ml::movar::option<T>> : ml::movar::variant_hash<ml::movar::option<T>>
+{};
+
+template<class T1, class T2>
+  requires (ml::internal::movar::hashable<T1> && ml::internal::movar::hashable<T2>)
+struct std::hash<ml::movar::either<T1, T2>> : ml::movar::variant_hash<ml::movar::either<T1, T2>>
+{};
+
+template<class... Ts>
+  requires (ml::internal::movar::hashable<Ts> && ...)
+struct std::hash<ml::movar::variant<Ts...>> : ml::movar::variant_hash<ml::movar::variant<Ts...>>
+{};
+
+template<class... Ts>
+  requires (ml::internal::movar::hashable<Ts> && ...)
+struct std::hash<ml::movar::maybe<Ts...>> : ml::movar::variant_hash<ml::movar::maybe<Ts...>>
+{};
\ No newline at end of file
@@ -3,23 +3,27 @@
 
 namespace ml::internal::movar
 {
-  template<Variant Self, class Fn>
+  // Self may be qualified: the visitor is invoked with the alternatives of Self as passed by visitation.
+  template<class Self, class Fn>
   static constexpr auto _deduce_map_result ()
   {
-    if constexpr (None<Self>) {
-      return simplify_impl<Self> ();
-    } else if constexpr (Some<Self>) {
-      using alts = alternatives<Self>;
-      using possible_results = mp_transform<mp_bind_front<wrap_invoke_result, Fn>::template fn, alts>;
-      return simplify_impl<mp_apply<join, possible_results>> ();
+    using unqual = remove_cvref_t<Self>;
+    if constexpr (None<unqual>) {
+      return simplify_impl<unqual> ();
     } else {
-      using alts = mp_remove<alternatives<Self>, nothing>;
-      using possible_results = mp_transform<mp_bind_front<wrap_invoke_result, Fn>::template fn, alts>;
-      return add_nothing_impl<mp_apply<join, possible_results>> ();
+      using alts = mp_remove<alternatives<unqual>, nothing>;
+      using args = mp_transform<mp_bind_front<visit_arg, Self>::template fn, alts>;
+      using possible_results = mp_transform<mp_bind_front<wrap_invoke_result, Fn>::template fn, args>;
+      if constexpr (Some<unqual>) {
+        return simplify_impl<mp_apply<join, possible_results>> ();
+      } else {
+        return add_nothing_impl<mp_apply<join, possible_results>> ();
+      }
     }
   }
 
-  template<Variant Self, class Fn>
+  template<class Self, class Fn>
+    requires Variant<remove_cvref_t<Self>>
   using map_result_t = typename decltype (_deduce_map_result<Self, Fn> ())::type;
 
   template<class Var, class Fn>
@@ -13,11 +13,11 @@ namespace ml::internal::movar
     using result_type = or_else_result_t<unqual, Default>;
 
     if constexpr (None<unqual>) {
-      return result_type (impl::wrap_invoke (std::forward<Default> (lazy)));
+      return impl::wrap_invoke_r<result_type> (std::forward<Default> (lazy));
     } else {
       if constexpr (Maybe<unqual>)
         if (var.is_nothing ())
-          return result_type (impl::wrap_invoke (std::forward<Default> (lazy)));
+          return impl::wrap_invoke_r<result_type> (std::forward<Default> (lazy));
       return result_type (std::forward<Var> (var));
     }
   }
@@ -1,12 +1,36 @@
 #pragma once
-#include <ml/movar/internal/core/core.hpp>
+#include <ml/movar/internal/algorithm/fuse.hpp>
 
 namespace ml::internal::movar
 {
+  template<class T>
+  constexpr inline long sequence_length = -1;
+
+  template<class... Ts>
+  constexpr inline long sequence_length<sequence<Ts...>> = sizeof...(Ts);
+
+  /*
+   * Pipelines are rewritten as they are built: the last stage of a sequence is fused with the stage
+   * appended to it, and two consecutive filters become a single filter over the conjunction of their
+   * predicates. The rewritten pipeline returns the same type and value as the unfused one.
+   */
   template<class Lhs, class Rhs>
   static constexpr auto impl::pipe_sequence (Lhs&& lhs, Rhs&& rhs)
   {
-    return ml::movar::sequence (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs));
+    using lhs_type = remove_cvref_t<Lhs>;
+    using rhs_type = remove_cvref_t<Rhs>;
+    if constexpr (sequence_length<lhs_type> == 0) {
+      return ml::movar::sequence (impl::fuse (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs)));
+    } else if constexpr (sequence_length<lhs_type> == 1) {
+      return ml::movar::sequence (impl::fuse (std::forward<Lhs> (lhs)._fn, std::forward<Rhs> (rhs)));
+    } else if constexpr (sequence_length<lhs_type> == 2) {
+      return ml::movar::sequence (std::forward<Lhs> (lhs)._fn1, //
+        impl::fuse (std::forward<Lhs> (lhs)._fn2, std::forward<Rhs> (rhs)));
+    } else if constexpr (is_filter<lhs_type> && is_filter<rhs_type>) {
+      return impl::fuse (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs));
+    } else {
+      return ml::movar::sequence (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs));
+    }
   }
 
   template<class Lhs, class Rhs>
@@ -14,4 +38,4 @@ namespace ml::internal::movar
   {
     return ml::movar::fork (std::forward<Lhs> (lhs), std::forward<Rhs> (rhs));
   }
-} // namespace ml::internal::movar
\ No newline at end of file
+} // namespace ml::internal::movar
@@ -0,0 +1,69 @@
+#pragma once
+#include <ml/movar/internal/algorithm/match.hpp>
+#include <ml/movar/internal/algorithm/or_else.hpp>
+
+namespace ml::internal::movar
+{
+  template<long Index, class List>
+  struct static_variant_impl;
+
+  template<long Index, class... Ts>
+  struct static_variant_impl<Index, mp_list<Ts...>> : type_identity<static_variant<Index, Ts...>>
+  {};
+
+  // The static counterpart of the Variant R when its active alternative is T.
+  template<Variant R, class T>
+    requires ContainsAlternative<R, T>
+  using static_variant_of = typename static_variant_impl<alternative_index<R, T>, alternatives<R>>::type;
+
+  // Invokes fn and keeps the index of the result static when it is known: a plain value becomes a
+  // static_variant of R and void becomes nothing, while a Variant result is converted to R.
+  template<class R, class Fn, class Arg>
+  static constexpr auto _static_invoke_r (Fn&& fn, Arg&& arg)
+  {
+    using unqual = remove_cvref_t<invoke_result_t<Fn, Arg>>;
+    if constexpr (is_void_v<unqual> || None<unqual>) {
+      std::invoke (std::forward<Fn> (fn), std::forward<Arg> (arg));
+      return nothing ();
+    } else if constexpr (Variant<unqual>) {
+      return R (std::invoke (std::forward<Fn> (fn), std::forward<Arg> (arg)));
+    } else {
+      return static_variant_of<R, unqual> (std::in_place, //
+        std::invoke (std::forward<Fn> (fn), std::forward<Arg> (arg)));
+    }
+  }
+
+  template<class Self, class Fn>
+  static constexpr auto impl::static_map (Self&& self, Fn&& fn)
+  {
+    using dynamic = copy_quals<Self, typename remove_cvref_t<Self>::dynamic_type>;
+    using result_type = map_result_t<dynamic, Fn>;
+    return _static_invoke_r<result_type> (std::forward<Fn> (fn), std::forward<Self> (self).get ());
+  }
+
+  template<class Self, class Fn>
+  static constexpr auto impl::static_match (Self&& self, Fn&& fn)
+  {
+    using dynamic = copy_quals<Self, typename remove_cvref_t<Self>::dynamic_type>;
+    using result_type = match_result_t<dynamic, Fn>;
+    return _static_invoke_r<result_type> (std::forward<Fn> (fn), std::forward<Self> (self).get ());
+  }
+
+  template<class Arg>
+  static constexpr decltype (auto) impl::unwrap_static (Arg&& arg) noexcept
+  {
+    if constexpr (is_static_variant<remove_cvref_t<Arg>>)
+      return static_cast<pipeline_arg<Arg>> (arg._value);
+    else
+      return std::forward<Arg> (arg);
+  }
+
+  template<class Self, class Default>
+  static constexpr auto impl::static_or_else (Self&& self, Default&&)
+  {
+    using unqual = remove_cvref_t<Self>;
+    using result_type = or_else_result_t<typename unqual::dynamic_type, Default>;
+    using value_type = typename unqual::value_type;
+    return static_variant_of<result_type, value_type> (std::in_place, std::forward<Self> (self).get ());
+  }
+} // namespace ml::internal::movar
\ No newline at end of file
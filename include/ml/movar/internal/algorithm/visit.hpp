@@ -3,12 +3,26 @@
 
 namespace ml::internal::movar
 {
+  // Visits nothing when a maybe is empty: kept out of line with ML_MOVAR_OUTLINE_COLD_PATHS.
+  template<class Vis>
+  ML_MOVAR_COLD static constexpr auto _visit_nothing (Vis&& vis)
+  {
+    return impl::wrap_invoke (std::forward<Vis> (vis), nothing ());
+  }
+
+  template<class R, class Vis>
+  ML_MOVAR_COLD static constexpr R _visit_nothing_r (Vis&& vis)
+  {
+    return impl::wrap_invoke_r<R> (std::forward<Vis> (vis), nothing ());
+  }
+
   template<class Vis, class Var>
   static constexpr auto impl::weak_visit (Vis&& vis, Var&& var)
   {
     using unqual = std::remove_cvref_t<Var>;
     return boost::mp11::mp_with_index<size<unqual>> (var.index (), [&] (auto I) {
-      return impl::wrap_invoke (std::forward<Vis> (vis), get<I> (std::forward<Var> (var)));
+      return impl::wrap_invoke (std::forward<Vis> (vis), //
+        std::forward<Var> (var).template get_unchecked<I> ());
     });
   }
 
@@ -17,7 +31,8 @@ namespace ml::internal::movar
   {
     using unqual = remove_cvref_t<Var>;
     return boost::mp11::mp_with_index<size<unqual>> (var.index (), [&] (auto I) -> R {
-      return R (impl::wrap_invoke (std::forward<Vis> (vis), get<I> (std::forward<Var> (var))));
+      return impl::wrap_invoke_r<R> (std::forward<Vis> (vis), //
+        std::forward<Var> (var).template get_unchecked<I> ());
     });
   }
 
@@ -30,7 +45,7 @@ namespace ml::internal::movar
     } else {
       if constexpr (Maybe<unqual>)
         if (var.is_nothing ())
-          return impl::wrap_invoke (std::forward<Vis> (vis), nothing ());
+          return _visit_nothing (std::forward<Vis> (vis));
       return impl::weak_visit (std::forward<Vis> (vis), std::forward<Var> (var));
     }
   }
@@ -40,11 +55,11 @@ namespace ml::internal::movar
   {
     using unqual = remove_cvref_t<Var>;
     if constexpr (None<unqual>) {
-      return R (impl::wrap_invoke (std::forward<Vis> (vis), nothing ()));
+      return impl::wrap_invoke_r<R> (std::forward<Vis> (vis), nothing ());
     } else {
       if constexpr (Maybe<unqual>)
         if (var.is_nothing ())
-          return R (impl::wrap_invoke (std::forward<Vis> (vis), nothing ()));
+          return _visit_nothing_r<R> (std::forward<Vis> (vis));
       return impl::weak_visit_r<R> (std::forward<Vis> (vis), std::forward<Var> (var));
     }
   }
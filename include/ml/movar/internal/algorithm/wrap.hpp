@@ -10,7 +10,7 @@ namespace ml::internal::movar
     if constexpr (Variant<unqual>) {
       return std::forward<Arg> (arg);
     } else {
-      return just (std::forward<Arg> (arg));
+      return just<std::decay_t<Arg>> (std::in_place_index<0>, std::forward<Arg> (arg));
     }
   }
 
@@ -27,4 +27,22 @@ namespace ml::internal::movar
       return impl::wrap (std::invoke (std::forward<Fn> (fn), std::forward<Args> (args)...));
     }
   }
+
+  template<class R, class Fn, class... Args>
+  static constexpr R impl::wrap_invoke_r (Fn&& fn, Args&&... args)
+  {
+    using unqual = remove_cvref_t<std::invoke_result_t<Fn, Args...>>;
+    if constexpr (!None<R> && !Variant<unqual> && !is_void_v<unqual>) {
+      if constexpr (contains_alternative<R, unqual>) {
+        // Construct the result in R directly, without an intermediate ml::movar::just.
+        constexpr long index = alternative_index<R, unqual>;
+        return R (std::in_place_index<index>, //
+          std::invoke (std::forward<Fn> (fn), std::forward<Args> (args)...));
+      } else {
+        return R (impl::wrap_invoke (std::forward<Fn> (fn), std::forward<Args> (args)...));
+      }
+    } else {
+      return R (impl::wrap_invoke (std::forward<Fn> (fn), std::forward<Args> (args)...));
+    }
+  }
 } // namespace ml::internal::movar
\ No newline at end of file
@@ -0,0 +1,377 @@
+#pragma once
+#include <ml/movar/internal/type/type.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace ml::internal::movar
+{
+  // Values compared by their bytes: trivially copyable objects whose equal values have equal object
+  // representations, which excludes classes with padding and long double, plus float and double,
+  // whose values are then compared bitwise as std::atomic compares them.
+  template<class T>
+  using is_packable = mp_bool<std::is_object_v<T> && std::is_trivially_copyable_v<T>
+    && (std::has_unique_object_representations_v<T> || is_same_v<std::remove_cv_t<T>, float>
+      || is_same_v<std::remove_cv_t<T>, double>)>;
+
+  template<class Var>
+  concept AtomicVariant = (Some<Var> || Maybe<Var>) && mp_all_of<alternatives<Var>, is_packable>::value;
+
+  /*
+   * A value is packed as a tag byte, omitted when Var has a single state, followed by the bytes of
+   * the active alternative. Unused bytes are zero, and alternatives have no padding, so that equal
+   * values pack to equal representations. A single word is assembled in a register on little endian
+   * platforms: writing the bytes one by one and loading them as a word stalls store forwarding.
+   */
+  template<AtomicVariant Var>
+  struct packed_layout
+  {
+    static constexpr std::size_t states = static_cast<std::size_t> (size<Var>) + (Maybe<Var> ? 1 : 0);
+    static constexpr std::size_t header = states > 1 ? 1 : 0;
+    static constexpr std::size_t bytes = header + []<class... Ts> (mp_list<Ts...>) {
+      return std::max ({sizeof (Ts)...});
+    }(alternatives<Var> {});
+
+    static constexpr bool in_register = bytes <= 8 && std::endian::native == std::endian::little;
+
+    template<std::size_t Size>
+    static std::array<std::byte, Size> pack (Var const& var) noexcept
+    {
+      if constexpr (Size == 8 && in_register) {
+        std::uint64_t word = 0;
+        if constexpr (header == 1)
+          word = static_cast<std::uint64_t> (var.index () + (Maybe<Var> ? 1 : 0));
+        if constexpr (Maybe<Var>)
+          if (var.is_nothing ())
+            return std::bit_cast<std::array<std::byte, Size>> (word);
+        word |= boost::mp11::mp_with_index<size<Var>> (var.index (), [&var] (auto I) {
+          auto const& alternative = var.template get_unchecked<I> ();
+          std::uint64_t payload = 0;
+          std::memcpy (&payload, std::addressof (alternative), sizeof (alternative));
+          return payload << (8 * header);
+        });
+        return std::bit_cast<std::array<std::byte, Size>> (word);
+      }
+      std::array<std::byte, Size> packed {};
+      if constexpr (header == 1)
+        packed[0] = static_cast<std::byte> (var.index () + (Maybe<Var> ? 1 : 0));
+      if constexpr (Maybe<Var>)
+        if (var.is_nothing ())
+          return packed;
+      boost::mp11::mp_with_index<size<Var>> (var.index (), [&var, &packed] (auto I) {
+        auto const& alternative = var.template get_unchecked<I> ();
+        std::memcpy (packed.data () + header, std::addressof (alternative), sizeof (alternative));
+      });
+      return packed;
+    }
+
+    template<std::size_t Size>
+    static Var unpack (std::array<std::byte, Size> const& packed) noexcept
+    {
+      if constexpr (Size == 8 && in_register) {
+        auto const word = std::bit_cast<std::uint64_t> (packed);
+        std::size_t index = header == 1 ? static_cast<std::size_t> (word & 0xff) : 0;
+        if constexpr (Maybe<Var>) {
+          if (index == 0)
+            return Var (nothing ());
+          --index;
+        }
+        return boost::mp11::mp_with_index<size<Var>> (index, [word] (auto I) {
+          using alternative = std::remove_const_t<movar::alternative<Var, I>>;
+          std::uint64_t const payload = word >> (8 * header);
+          std::array<std::byte, sizeof (alternative)> bytes;
+          std::memcpy (bytes.data (), &payload, sizeof (alternative));
+          return Var (std::in_place_index<I>, std::bit_cast<alternative> (bytes));
+        });
+      }
+      std::size_t index = header == 1 ? std::to_integer<std::size_t> (packed[0]) : 0;
+      if constexpr (Maybe<Var>) {
+        if (index == 0)
+          return Var (nothing ());
+        --index;
+      }
+      return boost::mp11::mp_with_index<size<Var>> (index, [&packed] (auto I) {
+        using alternative = std::remove_const_t<movar::alternative<Var, I>>;
+        std::array<std::byte, sizeof (alternative)> bytes;
+        std::memcpy (bytes.data (), packed.data () + header, sizeof (alternative));
+        return Var (std::in_place_index<I>, std::bit_cast<alternative> (bytes));
+      });
+    }
+  };
+
+  struct alignas (16) double_word
+  {
+    std::uint64_t low;
+    std::uint64_t high;
+  };
+
+  // The word used by the lock-free representation: 8 bytes when the packed value fits, 16 bytes when
+  // it fits and the platform has lock-free 16 byte atomics, and none otherwise.
+  template<std::size_t Bytes>
+  using atomic_word = std::conditional_t<(Bytes <= 8), std::uint64_t,
+    std::conditional_t<(Bytes <= 16 && std::atomic<double_word>::is_always_lock_free), double_word, void>>;
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::atomic_value
+   * @ingroup Variant
+   * @brief An atomic object holding a value of type @a Var, whose alternatives are trivially copyable
+   * and have no padding bytes.
+   *
+   * The value is packed into a tag byte followed by the bytes of its active alternative. When the
+   * packed value fits in 8 bytes, or in 16 bytes on platforms with lock-free 16 byte atomics, it is
+   * kept in a single lock-free std::atomic word and the memory orders passed to each operation are
+   * honored. Larger values are protected by a sequence lock: readers retry instead of blocking and
+   * writers exclude each other. The memory orders are then ignored, loads acquire and writes release.
+   *
+   * load returns a plain @a Var, so map, match and the other algorithms apply to the result.
+   * compare_exchange compares packed representations, as std::atomic compares object representations.
+   * Alternatives must therefore have unique object representations, so that equal values pack equally:
+   * a class with padding bytes, such as {char; int;}, is rejected. float and double are accepted and
+   * compared bitwise, like std::atomic<float>: -0.0 differs from 0.0 and a NaN may equal itself.
+   *
+   * See ml::movar::atomic_option and ml::movar::atomic_variant.
+   */
+  template<class Var>
+    requires (internal::movar::AtomicVariant<Var>)
+  struct atomic_value
+  {
+    using value_type = Var;
+    using _layout = internal::movar::packed_layout<Var>;
+    using _word = internal::movar::atomic_word<_layout::bytes>;
+
+    //! true if every operation is a single lock-free atomic instruction
+    static constexpr bool is_always_lock_free = !std::is_void_v<_word>;
+
+    // The packed value rounded up to whole words, which is also the size of _word when it is not void.
+    static constexpr std::size_t _words = (_layout::bytes + 7) / 8;
+
+    // The sequence lock: odd while a writer is active. The payload is kept in relaxed atomic words so
+    // that the retried reads of a reader racing with a writer are not data races.
+    struct _locked
+    {
+      std::atomic<std::uint64_t> sequence {0};
+      std::array<std::atomic<std::uint64_t>, _words> data {};
+    };
+
+    using _storage = std::conditional_t<is_always_lock_free, std::atomic<_word>, _locked>;
+    using _bytes = std::array<std::byte, _words * 8>;
+
+    _storage _storage_value {};
+
+    /*!
+     * @brief Holds a default constructed @a Var
+     */
+    atomic_value () noexcept
+      requires (std::default_initializable<Var>)
+      : atomic_value (Var ())
+    {}
+
+    /*!
+     * @brief Holds @a value
+     */
+    atomic_value (Var const& value) noexcept
+    {
+      _write (_pack (value));
+    }
+
+    atomic_value (atomic_value const&) = delete;
+    atomic_value& operator= (atomic_value const&) = delete;
+
+    //! @name Operations
+    //! @{
+
+    /*!
+     * @return the current value
+     */
+    [[nodiscard]] Var load (std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+      return _layout::unpack (_read (order));
+    }
+
+    /*!
+     * @brief Replaces the current value with @a value
+     */
+    void store (Var const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+      if constexpr (is_always_lock_free) {
+        _storage_value.store (_to_word (_pack (value)), order);
+      } else {
+        std::uint64_t const sequence = _lock ();
+        _store_data (_pack (value));
+        _unlock (sequence + 2);
+      }
+    }
+
+    /*!
+     * @brief Replaces the current value with @a value
+     * @return the previous value
+     */
+    Var exchange (Var const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+      if constexpr (is_always_lock_free) {
+        _word const desired = _to_word (_pack (value));
+        return _layout::unpack (_to_bytes (_storage_value.exchange (desired, order)));
+      } else {
+        std::uint64_t const sequence = _lock ();
+        _bytes const previous = _load_data ();
+        _store_data (_pack (value));
+        _unlock (sequence + 2);
+        return _layout::unpack (previous);
+      }
+    }
+
+    /*!
+     * @brief Replaces the current value with @a desired if it equals @a expected, otherwise loads it
+     * into @a expected
+     * @return true if the value was replaced
+     */
+    bool compare_exchange_strong (Var& expected, Var const& desired, //
+      std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+      return _compare_exchange<false> (expected, desired, order);
+    }
+
+    /*!
+     * @brief Like compare_exchange_strong, but may fail spuriously
+     */
+    bool compare_exchange_weak (Var& expected, Var const& desired, //
+      std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+      return _compare_exchange<true> (expected, desired, order);
+    }
+
+    /*!
+     * @brief Empties the value
+     * @return the previous value
+     */
+    Var take (std::memory_order order = std::memory_order_seq_cst) noexcept
+      requires (internal::movar::Maybe<Var>)
+    {
+      return exchange (Var (nothing ()), order);
+    }
+
+    //! @}
+
+    template<bool Weak>
+    bool _compare_exchange (Var& expected, Var const& desired, std::memory_order order) noexcept
+    {
+      _bytes const want = _pack (expected);
+      _bytes const next = _pack (desired);
+      if constexpr (is_always_lock_free) {
+        _word word = _to_word (want);
+        bool const exchanged = Weak ? _storage_value.compare_exchange_weak (word, _to_word (next), order)
+                                    : _storage_value.compare_exchange_strong (word, _to_word (next), order);
+        if (!exchanged)
+          expected = _layout::unpack (_to_bytes (word));
+        return exchanged;
+      } else {
+        std::uint64_t const sequence = _lock ();
+        _bytes const current = _load_data ();
+        if (current != want) {
+          _unlock (sequence);
+          expected = _layout::unpack (current);
+          return false;
+        }
+        _store_data (next);
+        _unlock (sequence + 2);
+        return true;
+      }
+    }
+
+    _bytes _read (std::memory_order order) const noexcept
+    {
+      if constexpr (is_always_lock_free) {
+        return _to_bytes (_storage_value.load (order));
+      } else {
+        for (;;) {
+          std::uint64_t const before = _storage_value.sequence.load (std::memory_order_acquire);
+          if (before % 2 == 0) {
+            _bytes const data = _load_data ();
+            std::atomic_thread_fence (std::memory_order_acquire);
+            if (_storage_value.sequence.load (std::memory_order_relaxed) == before)
+              return data;
+          }
+          std::this_thread::yield ();
+        }
+      }
+    }
+
+    void _write (_bytes const& bytes) noexcept
+    {
+      if constexpr (is_always_lock_free)
+        _storage_value.store (_to_word (bytes), std::memory_order_relaxed);
+      else
+        _store_data (bytes);
+    }
+
+    // Makes the sequence odd, waiting for the active writer if any, and returns its previous value.
+    std::uint64_t _lock () noexcept
+    {
+      std::atomic<std::uint64_t>& lock = _storage_value.sequence;
+      std::uint64_t sequence = lock.load (std::memory_order_relaxed);
+      while (sequence % 2 != 0 //
+        || !lock.compare_exchange_weak (sequence, sequence + 1, std::memory_order_acquire)) {
+        std::this_thread::yield ();
+        sequence = lock.load (std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence (std::memory_order_release);
+      return sequence;
+    }
+
+    void _unlock (std::uint64_t sequence) noexcept
+    {
+      _storage_value.sequence.store (sequence, std::memory_order_release);
+    }
+
+    _bytes _load_data () const noexcept
+    {
+      std::array<std::uint64_t, _words> words;
+      for (std::size_t i = 0; i != _words; ++i)
+        words[i] = _storage_value.data[i].load (std::memory_order_relaxed);
+      return std::bit_cast<_bytes> (words);
+    }
+
+    void _store_data (_bytes const& bytes) noexcept
+    {
+      auto const words = std::bit_cast<std::array<std::uint64_t, _words>> (bytes);
+      for (std::size_t i = 0; i != _words; ++i)
+        _storage_value.data[i].store (words[i], std::memory_order_relaxed);
+    }
+
+    static _bytes _pack (Var const& value) noexcept
+    {
+      return _layout::template pack<sizeof (_bytes)> (value);
+    }
+
+    static _word _to_word (_bytes const& bytes) noexcept
+    {
+      return std::bit_cast<_word> (bytes);
+    }
+
+    static _bytes _to_bytes (std::same_as<_word> auto const& word) noexcept
+    {
+      return std::bit_cast<_bytes> (word);
+    }
+  };
+
+  /*!
+   * @brief An atomic ml::movar::option
+   * @ingroup Variant
+   */
+  template<class T>
+  using atomic_option = atomic_value<option<T>>;
+
+  /*!
+   * @brief An atomic ml::movar::variant
+   * @ingroup Variant
+   */
+  template<class... Ts>
+  using atomic_variant = atomic_value<variant<Ts...>>;
+} // namespace ml::movar
\ No newline at end of file
@@ -0,0 +1,483 @@
+#pragma once
+#include <ml/movar/internal/algorithm/algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ml::internal::movar
+{
+  struct key_of_self
+  {
+    template<class T>
+    constexpr T const& operator() (T const& entry) const noexcept
+    {
+      return entry;
+    }
+  };
+
+  struct key_of_first
+  {
+    template<class T>
+    constexpr auto const& operator() (T const& entry) const noexcept
+    {
+      return entry.first;
+    }
+  };
+
+  /*
+   * Entries sorted by ml::movar::index_first_less on their key, so that the entries whose key has the same
+   * index form a contiguous segment. _offsets[s] is the first entry of segment s, where the segment of
+   * nothing comes first for maybe keys.
+   */
+  template<Variant Var, class Entry, class KeyOf>
+  struct flat_variant_base
+  {
+    static constexpr long _first = Maybe<Var> ? -1 : 0;
+    static constexpr std::size_t _segments = static_cast<std::size_t> (movar::size<Var> - _first);
+
+    // The result of a search: the segment, the position of the first entry not less than the key, and
+    // whether that entry is equivalent to the key.
+    struct _position
+    {
+      long index;
+      std::size_t offset;
+      bool found;
+    };
+
+    std::vector<Entry> _entries;
+    std::array<std::size_t, _segments + 1> _offsets {};
+
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<Entry>::const_iterator;
+
+    flat_variant_base () = default;
+
+    template<std::input_iterator It>
+    flat_variant_base (It first, It last)
+      : _entries (first, last)
+    {
+      auto const less = [] (Entry const& lhs, Entry const& rhs) {
+        return index_first_less (KeyOf {}(lhs), KeyOf {}(rhs));
+      };
+      auto const equivalent = [&less] (Entry const& lhs, Entry const& rhs) {
+        return !less (lhs, rhs) && !less (rhs, lhs);
+      };
+      std::stable_sort (_entries.begin (), _entries.end (), less);
+      _entries.erase (std::unique (_entries.begin (), _entries.end (), equivalent), _entries.end ());
+      for (auto const& entry : _entries)
+        ++_offsets[_segment (KeyOf {}(entry).index ()) + 1];
+      for (std::size_t s = 1; s <= _segments; ++s)
+        _offsets[s] += _offsets[s - 1];
+    }
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the number of entries
+     */
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return _entries.size ();
+    }
+
+    /*!
+     * @return true if there are no entries
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _entries.empty ();
+    }
+
+    /*!
+     * @return the entries whose key has index @a Index, in order
+     * @tparam Index must be in [0, size), or -1 for maybe keys
+     */
+    template<long Index>
+      requires (ContainsIndex<Var, Index> || (Index == -1 && Maybe<Var>))
+    [[nodiscard]] std::span<Entry const> segment () const noexcept
+    {
+      return {_entries.data () + _offsets[_segment (Index)], _entries.data () + _offsets[_segment (Index) + 1]};
+    }
+
+    /*!
+     * @return the entries whose key holds a @a T, in order
+     * @tparam T must be an alternative of the key, or ml::movar::nothing for maybe keys
+     */
+    template<class T>
+      requires (ContainsAlternative<Var, T> || (std::same_as<T, ml::movar::nothing> && Maybe<Var>))
+    [[nodiscard]] std::span<Entry const> segment () const noexcept
+    {
+      if constexpr (std::same_as<T, ml::movar::nothing>) {
+        return segment<-1> ();
+      } else {
+        return segment<alternative_index<Var, T>> ();
+      }
+    }
+
+    /*!
+     * @return the entry whose key is equivalent to @a key, or end () if there is none
+     */
+    template<class K>
+    [[nodiscard]] const_iterator find (K const& key) const
+    {
+      _position const position = _locate (key);
+      return position.found ? begin () + position.offset : end ();
+    }
+
+    /*!
+     * @return true if an entry has a key equivalent to @a key
+     */
+    template<class K>
+    [[nodiscard]] bool contains (K const& key) const
+    {
+      return _locate (key).found;
+    }
+
+    /*!
+     * @return the number of entries whose key is equivalent to @a key, 0 or 1
+     */
+    template<class K>
+    [[nodiscard]] size_type count (K const& key) const
+    {
+      return _locate (key).found ? 1 : 0;
+    }
+
+    /*!
+     * @return the first entry whose key is not less than @a key
+     */
+    template<class K>
+    [[nodiscard]] const_iterator lower_bound (K const& key) const
+    {
+      return begin () + _locate (key).offset;
+    }
+
+    /*!
+     * @return the first entry whose key is greater than @a key
+     */
+    template<class K>
+    [[nodiscard]] const_iterator upper_bound (K const& key) const
+    {
+      _position const position = _locate (key);
+      return begin () + position.offset + (position.found ? 1 : 0);
+    }
+
+    //! @}
+    //! @name Iterators
+    //! @{
+
+    [[nodiscard]] const_iterator begin () const noexcept
+    {
+      return _entries.begin ();
+    }
+
+    [[nodiscard]] const_iterator end () const noexcept
+    {
+      return _entries.end ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Removes the entry whose key is equivalent to @a key
+     * @return the number of removed entries
+     */
+    template<class K>
+      requires (!std::convertible_to<K, const_iterator>)
+    size_type erase (K const& key)
+    {
+      _position const position = _locate (key);
+      if (!position.found)
+        return 0;
+      _erase_at (position.index, position.offset);
+      return 1;
+    }
+
+    /*!
+     * @brief Removes all entries
+     */
+    void clear () noexcept
+    {
+      _entries.clear ();
+      _offsets.fill (0);
+    }
+
+    /*!
+     * @brief Makes room for @a count entries
+     */
+    void reserve (size_type count)
+    {
+      _entries.reserve (count);
+    }
+
+    //! @}
+
+    /*!
+     * @brief default equality
+     */
+    bool operator== (flat_variant_base const&) const = default;
+
+    static constexpr std::size_t _segment (long index) noexcept
+    {
+      return static_cast<std::size_t> (index - _first);
+    }
+
+    // Binary search restricted to the segment of Index, comparing values of a single alternative.
+    template<long Index, class T>
+    _position _search (T const& value) const
+    {
+      std::size_t const first = _offsets[_segment (Index)];
+      std::size_t const last = _offsets[_segment (Index) + 1];
+      if constexpr (Index == -1) {
+        return {Index, first, first != last};
+      } else {
+        auto const alternative = [] (Entry const& entry) -> auto const& {
+          return KeyOf {}(entry).template get_unchecked<Index> ();
+        };
+        auto const it = std::partition_point (_entries.begin () + first, _entries.begin () + last,
+          [&] (Entry const& entry) { return alternative (entry) < value; });
+        bool const found = it != _entries.begin () + last && !(value < alternative (*it));
+        return {Index, static_cast<std::size_t> (it - _entries.begin ()), found};
+      }
+    }
+
+    // Dispatches once on the index of a key, and not at all for a bare alternative.
+    template<class K>
+    _position _locate (K const& key) const
+    {
+      if constexpr (std::same_as<K, Var>) {
+        if constexpr (Maybe<Var>)
+          if (key.is_nothing ())
+            return _search<-1> (ml::movar::nothing ());
+        return boost::mp11::mp_with_index<movar::size<Var>> (key.index (), [this, &key] (auto I) {
+          return _search<I> (key.template get_unchecked<I> ());
+        });
+      } else if constexpr (std::same_as<K, ml::movar::nothing> && Maybe<Var>) {
+        return _search<-1> (key);
+      } else {
+        static_assert (ContainsAlternative<Var, K>, "the key must be a variant or one of its alternatives");
+        return _search<alternative_index<Var, K>> (key);
+      }
+    }
+
+    template<class... Args>
+    std::size_t _insert_at (_position const& position, Args&&... args)
+    {
+      _entries.emplace (_entries.begin () + position.offset, std::forward<Args> (args)...);
+      for (std::size_t s = _segment (position.index) + 1; s <= _segments; ++s)
+        ++_offsets[s];
+      return position.offset;
+    }
+
+    void _erase_at (long index, std::size_t offset)
+    {
+      _entries.erase (_entries.begin () + offset);
+      for (std::size_t s = _segment (index) + 1; s <= _segments; ++s)
+        --_offsets[s];
+    }
+  };
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::flat_variant_set
+   * @ingroup Container
+   * @brief A sorted set of variants in contiguous storage, partitioned by alternative.
+   *
+   * Elements are ordered by ml::movar::index_first_less, so the elements holding the same alternative
+   * are contiguous and segment () returns them as a span. A search dispatches once on the index of the
+   * key, or not at all for a bare alternative value, then binary-searches the segment of that index
+   * comparing values of a single type.
+   *
+   * Insertions and erasures shift the following elements and invalidate iterators.
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var>)
+  struct flat_variant_set : internal::movar::flat_variant_base<Var, Var, internal::movar::key_of_self>
+  {
+    using base = internal::movar::flat_variant_base<Var, Var, internal::movar::key_of_self>;
+
+    using key_type = Var;
+    using value_type = Var;
+    using key_compare = index_first_less<Var>;
+    using iterator = typename base::const_iterator;
+
+    /*!
+     * @brief default constructor
+     */
+    flat_variant_set () = default;
+
+    /*!
+     * @brief Sorts the elements in [@a first, @a last), keeping the first of equivalent ones
+     */
+    template<std::input_iterator It>
+    flat_variant_set (It first, It last)
+      : base (first, last)
+    {}
+
+    flat_variant_set (std::initializer_list<Var> values)
+      : base (values.begin (), values.end ())
+    {}
+
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Inserts @a value, unless an equivalent element is present
+     * @return the element equivalent to @a value, and true if it was inserted
+     */
+    std::pair<iterator, bool> insert (Var value)
+    {
+      auto const position = this->_locate (value);
+      if (position.found)
+        return {this->begin () + position.offset, false};
+      return {this->begin () + this->_insert_at (position, std::move (value)), true};
+    }
+
+    using base::erase;
+
+    /*!
+     * @brief Removes the element at @a position
+     * @return the element following the removed one
+     */
+    iterator erase (iterator position)
+    {
+      std::size_t const offset = position - this->begin ();
+      this->_erase_at (position->index (), offset);
+      return this->begin () + offset;
+    }
+
+    //! @}
+  };
+
+  /*! @class ml::movar::flat_variant_map
+   * @ingroup Container
+   * @brief A sorted map keyed by variants in contiguous storage, partitioned by alternative.
+   *
+   * Entries are pairs ordered by ml::movar::index_first_less on their key: see
+   * ml::movar::flat_variant_set. The key of an entry must not be modified through an iterator.
+   */
+  template<class Key, class Value>
+    requires (internal::movar::Variant<Key>)
+  struct flat_variant_map
+    : internal::movar::flat_variant_base<Key, std::pair<Key, Value>, internal::movar::key_of_first>
+  {
+    using base = internal::movar::flat_variant_base<Key, std::pair<Key, Value>, internal::movar::key_of_first>;
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using key_compare = index_first_less<Key>;
+    using iterator = typename std::vector<value_type>::iterator;
+
+    /*!
+     * @brief default constructor
+     */
+    flat_variant_map () = default;
+
+    /*!
+     * @brief Sorts the entries in [@a first, @a last), keeping the first of equivalent keys
+     */
+    template<std::input_iterator It>
+    flat_variant_map (It first, It last)
+      : base (first, last)
+    {}
+
+    flat_variant_map (std::initializer_list<value_type> entries)
+      : base (entries.begin (), entries.end ())
+    {}
+
+    //! @name Observers
+    //! @{
+
+    using base::find;
+
+    /*!
+     * @return the entry whose key is equivalent to @a key, or end () if there is none
+     */
+    template<class K>
+    [[nodiscard]] iterator find (K const& key)
+    {
+      auto const position = this->_locate (key);
+      return position.found ? begin () + position.offset : end ();
+    }
+
+    //! @}
+    //! @name Iterators
+    //! @{
+
+    using base::begin;
+    using base::end;
+
+    [[nodiscard]] iterator begin () noexcept
+    {
+      return this->_entries.begin ();
+    }
+
+    [[nodiscard]] iterator end () noexcept
+    {
+      return this->_entries.end ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Inserts an entry with key @a key and a value constructed from @a args, unless the key is present
+     * @return the entry with key @a key, and true if it was inserted
+     */
+    template<class K, class... Args>
+    std::pair<iterator, bool> try_emplace (K&& key, Args&&... args)
+    {
+      auto const position = this->_locate (key);
+      if (position.found)
+        return {begin () + position.offset, false};
+      std::size_t const offset = this->_insert_at (position, std::piecewise_construct, //
+        std::forward_as_tuple (std::forward<K> (key)),
+        std::forward_as_tuple (std::forward<Args> (args)...));
+      return {begin () + offset, true};
+    }
+
+    /*!
+     * @brief Inserts @a entry, unless its key is present
+     * @return the entry with the same key, and true if it was inserted
+     */
+    std::pair<iterator, bool> insert (value_type entry)
+    {
+      return try_emplace (std::move (entry.first), std::move (entry.second));
+    }
+
+    /*!
+     * @return the value with key @a key, inserting a value-initialized one if the key is not present
+     */
+    template<class K>
+    Value& operator[] (K&& key)
+    {
+      return try_emplace (std::forward<K> (key)).first->second;
+    }
+
+    using base::erase;
+
+    /*!
+     * @brief Removes the entry at @a position
+     * @return the entry following the removed one
+     */
+    iterator erase (typename base::const_iterator position)
+    {
+      std::size_t const offset = position - base::begin ();
+      this->_erase_at (position->first.index (), offset);
+      return begin () + offset;
+    }
+
+    //! @}
+  };
+} // namespace ml::movar
\ No newline at end of file
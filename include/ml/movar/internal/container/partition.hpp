@@ -0,0 +1,189 @@
+#pragma once
+#include <ml/movar/internal/algorithm/algorithm.hpp>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace ml::internal::movar
+{
+  template<class R>
+  concept VariantRange = std::ranges::random_access_range<R> && std::ranges::borrowed_range<R>
+    && Variant<std::ranges::range_value_t<R>> && !None<std::ranges::range_value_t<R>>;
+
+  // The segment of each index: nothing first for maybe types, then the alternatives in index order.
+  template<Variant Var>
+  struct index_segments
+  {
+    static constexpr long first = Maybe<Var> ? -1 : 0;
+    static constexpr std::size_t count = static_cast<std::size_t> (size<Var> - first);
+
+    static constexpr std::size_t of (Var const& var) noexcept
+    {
+      return static_cast<std::size_t> (var.index () - first);
+    }
+  };
+
+  // Counts the elements of every segment and turns the counts into the first position of each.
+  template<class Var, class It>
+  std::array<std::size_t, index_segments<Var>::count + 1> segment_offsets (It first, It last)
+  {
+    std::array<std::size_t, index_segments<Var>::count + 1> offsets {};
+    for (; first != last; ++first)
+      ++offsets[index_segments<Var>::of (*first) + 1];
+    for (std::size_t s = 1; s < offsets.size (); ++s)
+      offsets[s] += offsets[s - 1];
+    return offsets;
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::index_partition
+   * @ingroup Container
+   * @brief The result of ml::movar::partition_by_alternative and ml::movar::stable_sort_by_index: a range
+   * of @a Var grouped by index, with the subrange of each index.
+   */
+  template<class Var, class It>
+  struct index_partition
+  {
+    using _segments = internal::movar::index_segments<Var>;
+    using subrange = std::ranges::subrange<It>;
+
+    std::array<It, _segments::count + 1> _bounds;
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the elements holding the alternative at @a Index, or nothing if @a Index is -1
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<Var, Index> || (Index == -1 && internal::movar::Maybe<Var>))
+    [[nodiscard]] subrange segment () const noexcept
+    {
+      return segment (Index);
+    }
+
+    /*!
+     * @return the elements holding @a T, or nothing if @a T is nothing
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<Var, T>
+        || (std::same_as<T, nothing> && internal::movar::Maybe<Var>))
+    [[nodiscard]] subrange segment () const noexcept
+    {
+      if constexpr (std::same_as<T, nothing>)
+        return segment (-1);
+      else
+        return segment (internal::movar::alternative_index<Var, T>);
+    }
+
+    /*!
+     * @return the elements whose index is @a index
+     * @pre @a index is an index of @a Var, or -1 if @a Var is a maybe
+     */
+    [[nodiscard]] subrange segment (long index) const noexcept
+    {
+      auto const s = static_cast<std::size_t> (index - _segments::first);
+      return {_bounds[s], _bounds[s + 1]};
+    }
+
+    /*!
+     * @return the whole range
+     */
+    [[nodiscard]] subrange all () const noexcept
+    {
+      return {_bounds.front (), _bounds.back ()};
+    }
+
+    //! @}
+  };
+
+  /*!
+   * @brief Groups the elements of @a range by index, with nothing first and then in index order
+   * @ingroup Container
+   *
+   * One counting pass over the indices finds the bounds of every group, and a second pass carries each
+   * misplaced element along the cycle of elements it displaces until the cycle closes, without any
+   * allocation. The order within a group is not preserved: use ml::movar::stable_sort_by_index for that.
+   * @return the subrange of every index
+   */
+  template<class R>
+    requires (internal::movar::VariantRange<R>)
+  auto partition_by_alternative (R&& range)
+  {
+    using var = std::ranges::range_value_t<R>;
+    using segments = internal::movar::index_segments<var>;
+
+    auto const first = std::ranges::begin (range);
+    auto const offsets = internal::movar::segment_offsets<var> (first, std::ranges::end (range));
+
+    index_partition<var, std::ranges::iterator_t<R>> result;
+    for (std::size_t s = 0; s != offsets.size (); ++s)
+      result._bounds[s] = first + static_cast<std::ptrdiff_t> (offsets[s]);
+
+    auto heads = result._bounds;
+    for (std::size_t s = 0; s != segments::count; ++s) {
+      for (; heads[s] != result._bounds[s + 1]; ++heads[s]) {
+        std::size_t target = segments::of (*heads[s]);
+        if (target == s)
+          continue;
+        var carried = std::ranges::iter_move (heads[s]);
+        do {
+          auto const slot = heads[target]++;
+          std::size_t const next = segments::of (*slot);
+          std::swap (carried, *slot);
+          target = next;
+        } while (target != s);
+        *heads[s] = std::move (carried);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * @brief Groups the elements of @a range by index like ml::movar::partition_by_alternative, keeping
+   * their relative order within each group
+   * @ingroup Container
+   *
+   * A counting sort on the indices: every element is moved once into its place in a temporary buffer
+   * and once back. Falls back to std::ranges::stable_sort on the index when moving @a Var can throw.
+   * @return the subrange of every index
+   */
+  template<class R>
+    requires (internal::movar::VariantRange<R>)
+  auto stable_sort_by_index (R&& range)
+  {
+    using var = std::ranges::range_value_t<R>;
+    using segments = internal::movar::index_segments<var>;
+
+    auto const first = std::ranges::begin (range);
+    auto const last = std::ranges::end (range);
+    auto offsets = internal::movar::segment_offsets<var> (first, last);
+
+    index_partition<var, std::ranges::iterator_t<R>> result;
+    for (std::size_t s = 0; s != offsets.size (); ++s)
+      result._bounds[s] = first + static_cast<std::ptrdiff_t> (offsets[s]);
+
+    if constexpr (std::is_nothrow_move_constructible_v<var> && std::is_nothrow_move_assignable_v<var>) {
+      std::allocator<var> allocator;
+      auto const count = offsets.back ();
+      var* const buffer = allocator.allocate (count);
+      for (auto it = first; it != last; ++it)
+        std::construct_at (buffer + offsets[segments::of (*it)]++, std::ranges::iter_move (it));
+      auto it = first;
+      for (std::size_t i = 0; i != count; ++i, ++it) {
+        *it = std::move (buffer[i]);
+        std::destroy_at (buffer + i);
+      }
+      allocator.deallocate (buffer, count);
+    } else {
+      std::ranges::stable_sort (first, last, {}, &segments::of);
+    }
+    return result;
+  }
+} // namespace ml::movar
\ No newline at end of file
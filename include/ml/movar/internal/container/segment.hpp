@@ -0,0 +1,171 @@
+#pragma once
+#include <ml/movar/internal/core/core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ml::internal::movar
+{
+  /*
+   * A growable array of bool holding one bool object per element, unlike std::vector<bool>: elements
+   * can be referenced and the array viewed as a std::span<bool>. Provides the part of the std::vector
+   * interface that the containers use on their segments.
+   */
+  struct bool_vector
+  {
+    using value_type = bool;
+    using size_type = std::size_t;
+    using iterator = bool*;
+    using const_iterator = bool const*;
+
+    std::unique_ptr<bool[]> _data;
+    size_type _size = 0;
+    size_type _capacity = 0;
+
+    bool_vector () = default;
+
+    bool_vector (bool_vector const& other)
+      : _data (other._size == 0 ? nullptr : std::make_unique_for_overwrite<bool[]> (other._size))
+      , _size (other._size)
+      , _capacity (other._size)
+    {
+      std::copy_n (other._data.get (), _size, _data.get ());
+    }
+
+    bool_vector (bool_vector&& other) noexcept
+      : _data (std::move (other._data))
+      , _size (std::exchange (other._size, 0))
+      , _capacity (std::exchange (other._capacity, 0))
+    {}
+
+    bool_vector& operator= (bool_vector const& other)
+    {
+      if (this != &other) {
+        bool_vector copy (other);
+        swap (copy);
+      }
+      return *this;
+    }
+
+    bool_vector& operator= (bool_vector&& other) noexcept
+    {
+      if (this != &other) {
+        bool_vector moved (std::move (other));
+        swap (moved);
+      }
+      return *this;
+    }
+
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return _size;
+    }
+
+    [[nodiscard]] size_type capacity () const noexcept
+    {
+      return _capacity;
+    }
+
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _size == 0;
+    }
+
+    [[nodiscard]] bool* data () noexcept
+    {
+      return _data.get ();
+    }
+
+    [[nodiscard]] bool const* data () const noexcept
+    {
+      return _data.get ();
+    }
+
+    [[nodiscard]] iterator begin () noexcept
+    {
+      return data ();
+    }
+
+    [[nodiscard]] const_iterator begin () const noexcept
+    {
+      return data ();
+    }
+
+    [[nodiscard]] iterator end () noexcept
+    {
+      return data () + _size;
+    }
+
+    [[nodiscard]] const_iterator end () const noexcept
+    {
+      return data () + _size;
+    }
+
+    [[nodiscard]] bool& operator[] (size_type i) noexcept
+    {
+      return _data[i];
+    }
+
+    [[nodiscard]] bool const& operator[] (size_type i) const noexcept
+    {
+      return _data[i];
+    }
+
+    void reserve (size_type capacity)
+    {
+      if (capacity <= _capacity)
+        return;
+      auto data = std::make_unique_for_overwrite<bool[]> (capacity);
+      std::copy_n (_data.get (), _size, data.get ());
+      _data = std::move (data);
+      _capacity = capacity;
+    }
+
+    template<class... Args>
+    bool& emplace_back (Args&&... args)
+    {
+      if (_size == _capacity)
+        reserve (_capacity < 8 ? 16 : 2 * _capacity);
+      _data[_size] = bool (std::forward<Args> (args)...);
+      return _data[_size++];
+    }
+
+    void push_back (bool value)
+    {
+      emplace_back (value);
+    }
+
+    void clear () noexcept
+    {
+      _size = 0;
+    }
+
+    void swap (bool_vector& other) noexcept
+    {
+      using std::swap;
+      swap (_data, other._data);
+      swap (_size, other._size);
+      swap (_capacity, other._capacity);
+    }
+
+    template<class Pred>
+    friend size_type erase_if (bool_vector& values, Pred pred)
+    {
+      bool* const last = std::remove_if (values.begin (), values.end (), pred);
+      size_type const removed = static_cast<size_type> (values.end () - last);
+      values._size -= removed;
+      return removed;
+    }
+
+    friend bool operator== (bool_vector const& lhs, bool_vector const& rhs) noexcept
+    {
+      return std::equal (lhs.begin (), lhs.end (), rhs.begin (), rhs.end ());
+    }
+  };
+
+  // The contiguous array holding the values of type T in a container.
+  template<class T>
+  using segment_vector = conditional_t<is_same_v<T, bool>, bool_vector, std::vector<T>>;
+} // namespace ml::internal::movar
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+#include <ml/movar/internal/algorithm/algorithm.hpp>
+#include <ml/movar/internal/container/segment.hpp>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::variant_collection
+   * @ingroup Container
+   * @brief A collection of objects of types @a Ts, each type stored in its own contiguous segment.
+   *
+   * Every element takes the size of its own type instead of the size of the largest alternative, and
+   * iteration visits one segment at a time: match_each dispatches once per type, not once per element.
+   * Elements of the same type keep their insertion order; the order between types is the order of
+   * @a Ts.
+   *
+   * Values of any movar type whose alternatives are among @a Ts can be inserted; empty values are
+   * skipped. See ml::movar::variant_collection_for to build the collection of a variant type.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct variant_collection
+  {
+    static_assert ((std::is_object_v<Ts> && ...));
+    static_assert ((!std::is_const_v<Ts> && ...));
+    static_assert (boost::mp11::mp_is_set<internal::movar::mp_list<Ts...>>::value);
+
+    using size_type = std::size_t;
+
+    std::tuple<internal::movar::segment_vector<Ts>...> _segments;
+
+    template<class T>
+    static constexpr std::size_t _position = internal::movar::mp_find<internal::movar::mp_list<Ts...>, T>::value;
+
+    template<class T>
+    static constexpr bool _contains = internal::movar::mp_contains<internal::movar::mp_list<Ts...>, T>::value;
+
+    template<class T>
+    using _is_element = internal::movar::mp_bool<_contains<T>>;
+
+    // A Var can be inserted if all of its alternatives are among Ts.
+    template<class Var>
+    static constexpr bool _accepts = [] {
+      if constexpr (internal::movar::Variant<Var> && !_contains<Var>) {
+        return internal::movar::mp_all_of<internal::movar::alternatives<Var>, _is_element>::value;
+      } else {
+        return false;
+      }
+    }();
+
+    /*!
+     * @brief default constructor
+     */
+    variant_collection () = default;
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the number of elements
+     */
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return std::apply ([] (auto const&... segments) { return (segments.size () + ...); }, _segments);
+    }
+
+    /*!
+     * @return the number of elements of type @a T
+     */
+    template<class T>
+      requires (_contains<T>)
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return std::get<_position<T>> (_segments).size ();
+    }
+
+    /*!
+     * @return true if there are no elements
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return size () == 0;
+    }
+
+    /*!
+     * @return the elements of type @a T, in insertion order
+     */
+    template<class T>
+      requires (_contains<T>)
+    [[nodiscard]] std::span<T> segment () noexcept
+    {
+      return std::get<_position<T>> (_segments);
+    }
+
+    /*!
+     * @return the elements of type @a T, in insertion order
+     */
+    template<class T>
+      requires (_contains<T>)
+    [[nodiscard]] std::span<T const> segment () const noexcept
+    {
+      return std::get<_position<T>> (_segments);
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Appends an object of type @a T constructed from @a args to its segment
+     * @return the new element
+     */
+    template<class T, class... Args>
+      requires (_contains<T> && std::constructible_from<T, Args...>)
+    T& emplace (Args&&... args)
+    {
+      return std::get<_position<T>> (_segments).emplace_back (std::forward<Args> (args)...);
+    }
+
+    /*!
+     * @brief Appends @a value to the segment of its type
+     */
+    template<class T>
+      requires (_contains<std::remove_cvref_t<T>>)
+    void insert (T&& value)
+    {
+      emplace<std::remove_cvref_t<T>> (std::forward<T> (value));
+    }
+
+    /*!
+     * @brief Appends the active alternative of @a var to its segment, or nothing if @a var is empty
+     * @return true if an element was inserted
+     */
+    template<class Var>
+      requires (_accepts<std::remove_cvref_t<Var>>)
+    bool insert (Var&& var)
+    {
+      using unqual = std::remove_cvref_t<Var>;
+      if constexpr (internal::movar::None<unqual>) {
+        return false;
+      } else {
+        if constexpr (internal::movar::Maybe<unqual>)
+          if (var.is_nothing ())
+            return false;
+        boost::mp11::mp_with_index<internal::movar::size<unqual>> (var.index (), [this, &var] (auto I) {
+          using alternative = internal::movar::alternative<unqual, I>;
+          emplace<alternative> (std::forward<Var> (var).template get_unchecked<I> ());
+        });
+        return true;
+      }
+    }
+
+    /*!
+     * @brief Removes all elements
+     */
+    void clear () noexcept
+    {
+      std::apply ([] (auto&... segments) { (segments.clear (), ...); }, _segments);
+    }
+
+    /*!
+     * @brief Makes room for @a count elements of type @a T
+     */
+    template<class T>
+      requires (_contains<T>)
+    void reserve (size_type count)
+    {
+      std::get<_position<T>> (_segments).reserve (count);
+    }
+
+    /*!
+     * @brief Removes the elements of type @a T that satisfy @a pred
+     * @return the number of removed elements
+     */
+    template<class T, class Pred>
+      requires (_contains<T> && std::predicate<Pred&, T const&>)
+    size_type erase_if (Pred pred)
+    {
+      using std::erase_if;
+      return erase_if (std::get<_position<T>> (_segments), pred);
+    }
+
+    //! @}
+    //! @name Pipeline
+    //! @{
+
+    /*!
+     * @brief Invokes @a vis on every element, one segment after the other
+     *
+     * @a vis is instantiated once per type and called in a plain loop over each segment, so there is no
+     * dispatch per element.
+     */
+    template<class Vis>
+      requires (std::invocable<Vis&, Ts&> && ...)
+    void match_each (Vis vis)
+    {
+      std::apply ([&vis] (auto&... segments) { (_match_segment (vis, segments), ...); }, _segments);
+    }
+
+    /*!
+     * @brief Invokes @a vis on every element, one segment after the other
+     */
+    template<class Vis>
+      requires (std::invocable<Vis&, Ts const&> && ...)
+    void match_each (Vis vis) const
+    {
+      std::apply ([&vis] (auto const&... segments) { (_match_segment (vis, segments), ...); }, _segments);
+    }
+
+    //! @}
+
+    /*!
+     * @brief default equality
+     */
+    bool operator== (variant_collection const&) const = default;
+
+    template<class Vis, class Segment>
+    static void _match_segment (Vis& vis, Segment& segment)
+    {
+      for (auto& element : segment)
+        std::invoke (vis, element);
+    }
+  };
+
+  /*!
+   * @brief The ml::movar::variant_collection of the alternatives of @a Var
+   * @ingroup Container
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var> && !internal::movar::None<Var>)
+  using variant_collection_for = internal::movar::mp_rename<internal::movar::alternatives<Var>, variant_collection>;
+} // namespace ml::movar
\ No newline at end of file
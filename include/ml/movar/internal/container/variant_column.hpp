@@ -0,0 +1,452 @@
+#pragma once
+#include <ml/movar/internal/algorithm/algorithm.hpp>
+#include <ml/movar/internal/container/segment.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if ML_MOVAR_HAS_SSE2
+#  include <emmintrin.h>
+#endif
+
+namespace ml::internal::movar
+{
+  // Counts the bytes of tags equal to tag, 16 at a time when SSE2 is available.
+  inline std::size_t count_tag (std::span<std::uint8_t const> tags, std::uint8_t tag) noexcept
+  {
+    std::size_t count = 0;
+    std::size_t i = 0;
+#if ML_MOVAR_HAS_SSE2
+    __m128i const needle = _mm_set1_epi8 (static_cast<char> (tag));
+    for (; i + 16 <= tags.size (); i += 16) {
+      __m128i const block = _mm_loadu_si128 (reinterpret_cast<__m128i const*> (tags.data () + i));
+      count += std::popcount (static_cast<unsigned> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (block, needle))));
+    }
+#endif
+    for (; i < tags.size (); ++i)
+      count += tags[i] == tag;
+    return count;
+  }
+
+  // Appends the positions of the bytes of tags equal to tag to rows, in increasing order.
+  inline void find_tag (std::span<std::uint8_t const> tags, std::uint8_t tag, //
+    std::vector<std::uint32_t>& rows)
+  {
+    std::size_t i = 0;
+#if ML_MOVAR_HAS_SSE2
+    __m128i const needle = _mm_set1_epi8 (static_cast<char> (tag));
+    for (; i + 16 <= tags.size (); i += 16) {
+      __m128i const block = _mm_loadu_si128 (reinterpret_cast<__m128i const*> (tags.data () + i));
+      auto mask = static_cast<unsigned> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (block, needle)));
+      for (; mask != 0; mask &= mask - 1)
+        rows.push_back (static_cast<std::uint32_t> (i + std::countr_zero (mask)));
+    }
+#endif
+    for (; i < tags.size (); ++i)
+      if (tags[i] == tag)
+        rows.push_back (static_cast<std::uint32_t> (i));
+  }
+
+  // The value stored in a column for the result of invoking Fn on T.
+  template<class Fn, class T>
+  using column_result = remove_cvref_t<std::invoke_result_t<Fn&, T>>;
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*! @class ml::movar::variant_column
+   * @ingroup Container
+   * @brief A sequence of values of type maybe<Ts...> stored column-wise.
+   *
+   * Each row is a one byte tag, 0 for nothing and i + 1 for the alternative at index i, plus the
+   * position of its value in the array of values of that alternative. Scans such as count and
+   * positions only read the tag array, 16 rows at a time when SSE2 is available, and map and match
+   * invoke their function in a plain loop over each array of values instead of dispatching per row.
+   *
+   * Values of any movar type whose alternatives are among @a Ts can be appended. See
+   * ml::movar::variant_column_for to build the column of a variant type.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0 && sizeof...(Ts) < 255)
+  struct variant_column
+  {
+    static_assert ((std::is_object_v<Ts> && ...));
+    static_assert ((!std::is_const_v<Ts> && ...));
+    static_assert ((!internal::movar::Variant<Ts> && ...));
+    static_assert (boost::mp11::mp_is_set<internal::movar::mp_list<Ts...>>::value);
+
+    using size_type = std::size_t;
+    using row_type = std::uint32_t;
+    using tag_type = std::uint8_t;
+    using const_reference = maybe_ref<Ts const...>;
+
+    std::vector<tag_type> _tags;
+    std::vector<row_type> _slots;
+    std::tuple<internal::movar::segment_vector<Ts>...> _payloads;
+
+    template<class T>
+    static constexpr std::size_t _position = internal::movar::mp_find<internal::movar::mp_list<Ts...>, T>::value;
+
+    template<class T>
+    static constexpr bool _contains = internal::movar::mp_contains<internal::movar::mp_list<Ts...>, T>::value;
+
+    template<class T>
+    using _is_element = internal::movar::mp_bool<_contains<T>>;
+
+    // The tag of the rows holding T, or of the empty rows if T is nothing.
+    template<class T>
+    static constexpr tag_type _tag = internal::movar::mp_find<internal::movar::mp_list<nothing, Ts...>, T>::value;
+
+    // A Var can be appended if all of its alternatives are among Ts.
+    template<class Var>
+    static constexpr bool _accepts = [] {
+      if constexpr (internal::movar::Variant<Var> && !_contains<Var>) {
+        return internal::movar::mp_all_of<internal::movar::alternatives<Var>, _is_element>::value;
+      } else {
+        return false;
+      }
+    }();
+
+    // The column holding the results Rs, where nothing stands for the empty rows.
+    template<class... Rs>
+    using _column_of = internal::movar::mp_rename<
+      internal::movar::mp_remove_if<internal::movar::mp_unique<internal::movar::mp_list<Rs...>>,
+        internal::movar::is_none>,
+      variant_column>;
+
+    /*!
+     * @brief default constructor
+     */
+    variant_column () = default;
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the number of rows
+     */
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return _tags.size ();
+    }
+
+    /*!
+     * @return true if there are no rows
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _tags.empty ();
+    }
+
+    /*!
+     * @return the tag of every row: 0 for nothing, i + 1 for the alternative at index i
+     */
+    [[nodiscard]] std::span<tag_type const> tags () const noexcept
+    {
+      return _tags;
+    }
+
+    /*!
+     * @return the values of the rows holding @a T, in no particular order
+     */
+    template<class T>
+      requires (_contains<T>)
+    [[nodiscard]] std::span<T const> segment () const noexcept
+    {
+      return std::get<_position<T>> (_payloads);
+    }
+
+    /*!
+     * @return a reference to the value of @a row
+     * @pre @a row < size ()
+     */
+    [[nodiscard]] const_reference operator[] (size_type row) const noexcept
+    {
+      tag_type const tag = _tags[row];
+      if (tag == 0)
+        return const_reference ();
+      return boost::mp11::mp_with_index<sizeof...(Ts)> (tag - 1, [this, row] (auto I) {
+        return const_reference (std::in_place_index<I>, std::get<I> (_payloads)[_slots[row]]);
+      });
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Appends a row holding an object of type @a T constructed from @a args
+     * @return the new value
+     */
+    template<class T, class... Args>
+      requires (_contains<T> && std::constructible_from<T, Args...>)
+    T& emplace_back (Args&&... args)
+    {
+      _make_room ();
+      auto& payload = std::get<_position<T>> (_payloads);
+      T& value = payload.emplace_back (std::forward<Args> (args)...);
+      _tags.push_back (_tag<T>);
+      _slots.push_back (static_cast<row_type> (payload.size () - 1));
+      return value;
+    }
+
+    /*!
+     * @brief Appends a row holding @a value
+     */
+    template<class T>
+      requires (_contains<std::remove_cvref_t<T>>)
+    void push_back (T&& value)
+    {
+      emplace_back<std::remove_cvref_t<T>> (std::forward<T> (value));
+    }
+
+    /*!
+     * @brief Appends a row holding the active alternative of @a var, or nothing if @a var is empty
+     */
+    template<class Var>
+      requires (_accepts<std::remove_cvref_t<Var>>)
+    void push_back (Var&& var)
+    {
+      using unqual = std::remove_cvref_t<Var>;
+      if constexpr (internal::movar::None<unqual>) {
+        _push_nothing ();
+      } else {
+        if constexpr (internal::movar::Maybe<unqual>)
+          if (var.is_nothing ())
+            return _push_nothing ();
+        boost::mp11::mp_with_index<internal::movar::size<unqual>> (var.index (), [this, &var] (auto I) {
+          using alternative = internal::movar::alternative<unqual, I>;
+          emplace_back<alternative> (std::forward<Var> (var).template get_unchecked<I> ());
+        });
+      }
+    }
+
+    /*!
+     * @brief Makes room for @a count rows
+     */
+    void reserve (size_type count)
+    {
+      _tags.reserve (count);
+      _slots.reserve (count);
+    }
+
+    /*!
+     * @brief Removes all rows
+     */
+    void clear () noexcept
+    {
+      _tags.clear ();
+      _slots.clear ();
+      std::apply ([] (auto&... payloads) { (payloads.clear (), ...); }, _payloads);
+    }
+
+    //! @}
+    //! @name Scans
+    //! @{
+
+    /*!
+     * @return the number of rows holding @a T, or of empty rows if @a T is nothing
+     */
+    template<class T>
+      requires (_contains<T> || std::same_as<T, nothing>)
+    [[nodiscard]] size_type count () const noexcept
+    {
+      return internal::movar::count_tag (_tags, _tag<T>);
+    }
+
+    /*!
+     * @return the rows holding @a T, or the empty rows if @a T is nothing, in increasing order
+     */
+    template<class T>
+      requires (_contains<T> || std::same_as<T, nothing>)
+    [[nodiscard]] std::vector<row_type> positions () const
+    {
+      std::vector<row_type> rows;
+      internal::movar::find_tag (_tags, _tag<T>, rows);
+      return rows;
+    }
+
+    /*!
+     * @return a column holding the given @a rows, in the given order
+     * @pre every row is < size ()
+     */
+    [[nodiscard]] variant_column gather (std::span<row_type const> rows) const
+    {
+      variant_column result;
+      result.reserve (rows.size ());
+      for (row_type row : rows) {
+        tag_type const tag = _tags[row];
+        if (tag == 0) {
+          result._push_nothing ();
+        } else {
+          boost::mp11::mp_with_index<sizeof...(Ts)> (tag - 1, [this, &result, row] (auto I) {
+            result.template emplace_back<internal::movar::mp_at_c<internal::movar::mp_list<Ts...>, I>> (
+              std::get<I> (_payloads)[_slots[row]]);
+          });
+        }
+      }
+      return result;
+    }
+
+    /*!
+     * @return a column holding the rows whose @a mask element is true, in order
+     * @pre mask.size () == size ()
+     */
+    [[nodiscard]] variant_column select (std::span<bool const> mask) const
+    {
+      static_assert (sizeof (bool) == 1);
+      std::span<std::uint8_t const> const bytes (reinterpret_cast<std::uint8_t const*> (mask.data ()), mask.size ());
+      std::vector<row_type> rows;
+      internal::movar::find_tag (bytes, 1, rows);
+      return gather (rows);
+    }
+
+    //! @}
+    //! @name Pipeline
+    //! @{
+
+    /*!
+     * @brief Maps every non-empty row with @a fn
+     *
+     * @a fn is invoked in a plain loop over the values of each alternative, not in row order. Empty
+     * rows, and rows for which @a fn returns nothing, are empty in the result.
+     * @return a column of the distinct result types
+     */
+    template<class Fn>
+      requires (std::invocable<Fn&, Ts const&> && ...)
+    [[nodiscard]] auto map (Fn fn) const
+    {
+      using result_type = _column_of<internal::movar::column_result<Fn, Ts const&>...>;
+      result_type result;
+      std::array<tag_type, sizeof...(Ts) + 1> tags {};
+      std::array<row_type, sizeof...(Ts) + 1> bases {};
+      _map_payloads (fn, result, tags, bases, std::index_sequence_for<Ts...> {});
+      _remap (result, tags, bases);
+      return result;
+    }
+
+    /*!
+     * @brief Maps every row with @a vis, including the empty rows
+     *
+     * Like map, with @a vis also invoked with nothing once per empty row.
+     * @return a column of the distinct result types
+     */
+    template<class Vis>
+      requires ((std::invocable<Vis&, Ts const&> && ...) && std::invocable<Vis&, nothing>)
+    [[nodiscard]] auto match (Vis vis) const
+    {
+      using nothing_result = internal::movar::column_result<Vis, nothing>;
+      using result_type = _column_of<internal::movar::column_result<Vis, Ts const&>..., nothing_result>;
+      result_type result;
+      std::array<tag_type, sizeof...(Ts) + 1> tags {};
+      std::array<row_type, sizeof...(Ts) + 1> bases {};
+      _map_payloads (vis, result, tags, bases, std::index_sequence_for<Ts...> {});
+      tags[0] = result_type::template _tag<nothing_result>;
+      _remap (result, tags, bases);
+      if constexpr (internal::movar::None<nothing_result>) {
+        for (std::size_t i = count<nothing> (); i != 0; --i)
+          std::invoke (vis, nothing ());
+      } else {
+        auto& payload = std::get<result_type::template _position<nothing_result>> (result._payloads);
+        for (row_type row : positions<nothing> ()) {
+          result._slots[row] = static_cast<row_type> (payload.size ());
+          payload.push_back (std::invoke (vis, nothing ()));
+        }
+      }
+      return result;
+    }
+
+    //! @}
+
+    /*!
+     * @return true if both columns hold equal values in the same rows
+     */
+    [[nodiscard]] bool operator== (variant_column const& other) const
+    {
+      if (_tags != other._tags)
+        return false;
+      for (size_type row = 0; row != size (); ++row) {
+        if (_tags[row] == 0)
+          continue;
+        bool const equal = boost::mp11::mp_with_index<sizeof...(Ts)> (_tags[row] - 1, [&] (auto I) -> bool {
+          return std::get<I> (_payloads)[_slots[row]] == std::get<I> (other._payloads)[other._slots[row]];
+        });
+        if (!equal)
+          return false;
+      }
+      return true;
+    }
+
+    // Grows the tag and slot arrays ahead of a push, so that appending a row cannot fail after its
+    // value has been constructed.
+    void _make_room ()
+    {
+      if (_tags.size () == _tags.capacity ())
+        reserve (_tags.size () < 8 ? 16 : 2 * _tags.size ());
+    }
+
+    void _push_nothing ()
+    {
+      _make_room ();
+      _tags.push_back (0);
+      _slots.push_back (0);
+    }
+
+    // Maps the values of every alternative into result, recording for the tag of each alternative its
+    // tag in result and the position of its first mapped value.
+    template<class Fn, class Result, std::size_t... I>
+    void _map_payloads (Fn& fn, Result& result, std::span<tag_type, sizeof...(Ts) + 1> tags,
+      std::span<row_type, sizeof...(Ts) + 1> bases, std::index_sequence<I...>) const
+    {
+      (_map_payload<I> (fn, result, tags[I + 1], bases[I + 1]), ...);
+    }
+
+    template<std::size_t I, class Fn, class Result>
+    void _map_payload (Fn& fn, Result& result, tag_type& tag, row_type& base) const
+    {
+      using source_type = internal::movar::mp_at_c<internal::movar::mp_list<Ts...>, I>;
+      using mapped = internal::movar::column_result<Fn, source_type const&>;
+      static_assert (!internal::movar::Variant<mapped> || internal::movar::None<mapped>,
+        "the results of a column map must be plain values or nothing");
+      tag = Result::template _tag<mapped>;
+      auto const& source = std::get<I> (_payloads);
+      if constexpr (internal::movar::None<mapped>) {
+        for (auto const& value : source)
+          std::invoke (fn, value);
+      } else {
+        auto& target = std::get<Result::template _position<mapped>> (result._payloads);
+        base = static_cast<row_type> (target.size ());
+        target.reserve (target.size () + source.size ());
+        for (auto const& value : source)
+          target.push_back (std::invoke (fn, value));
+      }
+    }
+
+    // Rewrites the tag and slot of every row with the tag and base of its alternative in result.
+    template<class Result>
+    void _remap (Result& result, std::span<tag_type const, sizeof...(Ts) + 1> tags,
+      std::span<row_type const, sizeof...(Ts) + 1> bases) const
+    {
+      result._tags.resize (size ());
+      result._slots.resize (size ());
+      for (size_type row = 0; row != size (); ++row) {
+        tag_type const tag = _tags[row];
+        result._tags[row] = tags[tag];
+        result._slots[row] = tags[tag] == 0 ? 0 : _slots[row] + bases[tag];
+      }
+    }
+  };
+
+  /*!
+   * @brief The ml::movar::variant_column of the alternatives of @a Var
+   * @ingroup Container
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var> && !internal::movar::None<Var>)
+  using variant_column_for = internal::movar::mp_rename<internal::movar::alternatives<Var>, variant_column>;
+} // namespace ml::movar
\ No newline at end of file
@@ -0,0 +1,499 @@
+#pragma once
+#include <ml/movar/internal/algorithm/algorithm.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace ml::movar
+{
+  /*! @defgroup Container Containers
+   */
+
+  /*! @class ml::movar::variant_map
+   * @ingroup Container
+   * @brief An open-addressing hash map keyed by a variant.
+   *
+   * Entries live in a single array probed linearly, next to an array of control bytes that holds seven
+   * bits of the hash of each entry: a lookup compares keys only when those bits match. Erased entries
+   * leave a marker that is reclaimed by the next insertion or rehash.
+   *
+   * With the default ml::movar::variant_hash and ml::movar::variant_equal, lookups and insertions accept
+   * bare alternatives of @a Key: the key is only constructed when a new entry is inserted.
+   *
+   * Insertions and rehashes invalidate iterators and references. The key of an entry must not be
+   * modified through an iterator.
+   */
+  template<class Key, class Value, class Hash = variant_hash<Key>, class KeyEqual = variant_equal<Key>>
+  struct variant_map
+  {
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    static constexpr std::uint8_t _empty = 0;
+    static constexpr std::uint8_t _erased = 1;
+    static constexpr size_type _min_capacity = 16;
+
+    template<bool Const>
+    struct _iterator
+    {
+      using iterator_concept = std::forward_iterator_tag;
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = variant_map::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<Const, value_type const*, value_type*>;
+      using reference = std::conditional_t<Const, value_type const&, value_type&>;
+
+      std::uint8_t const* _control = nullptr;
+      pointer _slots = nullptr;
+      size_type _index = 0;
+      size_type _capacity = 0;
+
+      _iterator () = default;
+
+      _iterator (std::uint8_t const* control, pointer slots, size_type index, size_type capacity) noexcept
+        : _control (control)
+        , _slots (slots)
+        , _index (index)
+        , _capacity (capacity)
+      {
+        _skip ();
+      }
+
+      template<bool OtherConst>
+        requires (Const && !OtherConst)
+      _iterator (_iterator<OtherConst> const& other) noexcept
+        : _control (other._control)
+        , _slots (other._slots)
+        , _index (other._index)
+        , _capacity (other._capacity)
+      {}
+
+      void _skip () noexcept
+      {
+        while (_index < _capacity && !(_control[_index] & 0x80))
+          ++_index;
+      }
+
+      reference operator* () const noexcept
+      {
+        return _slots[_index];
+      }
+
+      pointer operator->() const noexcept
+      {
+        return _slots + _index;
+      }
+
+      _iterator& operator++ () noexcept
+      {
+        ++_index;
+        _skip ();
+        return *this;
+      }
+
+      _iterator operator++ (int) noexcept
+      {
+        auto copy = *this;
+        ++*this;
+        return copy;
+      }
+
+      friend bool operator== (_iterator const& lhs, _iterator const& rhs) noexcept
+      {
+        return lhs._index == rhs._index;
+      }
+    };
+
+    using iterator = _iterator<false>;
+    using const_iterator = _iterator<true>;
+
+    std::unique_ptr<std::uint8_t[]> _control;
+    value_type* _slots = nullptr;
+    size_type _capacity = 0;
+    size_type _size = 0;
+    size_type _erased_count = 0;
+    [[no_unique_address]] Hash _hash;
+    [[no_unique_address]] KeyEqual _equal;
+
+    /*!
+     * @brief default constructor, allocates nothing
+     */
+    variant_map () = default;
+
+    /*!
+     * @brief Makes room for @a count entries
+     */
+    explicit variant_map (size_type count, Hash const& hash = Hash (), KeyEqual const& equal = KeyEqual ())
+      : _hash (hash)
+      , _equal (equal)
+    {
+      reserve (count);
+    }
+
+    variant_map (std::initializer_list<value_type> entries)
+      : variant_map (entries.size ())
+    {
+      for (auto const& entry : entries)
+        insert (entry);
+    }
+
+    variant_map (variant_map const& other)
+      : variant_map (other.size (), other._hash, other._equal)
+    {
+      for (auto const& entry : other)
+        insert (entry);
+    }
+
+    variant_map (variant_map&& other) noexcept
+      : _control (std::move (other._control))
+      , _slots (std::exchange (other._slots, nullptr))
+      , _capacity (std::exchange (other._capacity, 0))
+      , _size (std::exchange (other._size, 0))
+      , _erased_count (std::exchange (other._erased_count, 0))
+      , _hash (other._hash)
+      , _equal (other._equal)
+    {}
+
+    variant_map& operator= (variant_map const& other)
+    {
+      if (this != &other) {
+        variant_map copy (other);
+        swap (copy);
+      }
+      return *this;
+    }
+
+    variant_map& operator= (variant_map&& other) noexcept
+    {
+      if (this != &other) {
+        variant_map moved (std::move (other));
+        swap (moved);
+      }
+      return *this;
+    }
+
+    ~variant_map ()
+    {
+      _release ();
+    }
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the number of entries
+     */
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return _size;
+    }
+
+    /*!
+     * @return true if there are no entries
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _size == 0;
+    }
+
+    /*!
+     * @return the number of slots, a power of two or zero
+     */
+    [[nodiscard]] size_type capacity () const noexcept
+    {
+      return _capacity;
+    }
+
+    /*!
+     * @return the entry whose key equals @a key, or end () if there is none
+     */
+    template<class K>
+    [[nodiscard]] iterator find (K const& key)
+    {
+      return {_control.get (), _slots, _find (key), _capacity};
+    }
+
+    /*!
+     * @return the entry whose key equals @a key, or end () if there is none
+     */
+    template<class K>
+    [[nodiscard]] const_iterator find (K const& key) const
+    {
+      return {_control.get (), _slots, _find (key), _capacity};
+    }
+
+    /*!
+     * @return true if an entry has a key equal to @a key
+     */
+    template<class K>
+    [[nodiscard]] bool contains (K const& key) const
+    {
+      return _find (key) != _capacity;
+    }
+
+    //! @}
+    //! @name Iterators
+    //! @{
+
+    [[nodiscard]] iterator begin () noexcept
+    {
+      return {_control.get (), _slots, 0, _capacity};
+    }
+
+    [[nodiscard]] iterator end () noexcept
+    {
+      return {_control.get (), _slots, _capacity, _capacity};
+    }
+
+    [[nodiscard]] const_iterator begin () const noexcept
+    {
+      return {_control.get (), _slots, 0, _capacity};
+    }
+
+    [[nodiscard]] const_iterator end () const noexcept
+    {
+      return {_control.get (), _slots, _capacity, _capacity};
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Inserts an entry with key @a key and a value constructed from @a args, unless the key is present
+     * @return the entry with key @a key, and true if it was inserted
+     */
+    template<class K, class... Args>
+    std::pair<iterator, bool> try_emplace (K&& key, Args&&... args)
+    {
+      if ((_size + _erased_count + 1) * 8 > _capacity * 7)
+        _rehash (_size + 1 > _capacity / 2 ? std::max (_capacity * 2, _min_capacity) : _capacity);
+
+      std::size_t const hash = _hash (key);
+      size_type index = hash & (_capacity - 1);
+      size_type target = _capacity;
+      std::uint8_t const tag = _tag (hash);
+      for (;; index = (index + 1) & (_capacity - 1)) {
+        std::uint8_t const control = _control[index];
+        if (control == _empty)
+          break;
+        if (control == tag && _equal (_slots[index].first, key))
+          return {iterator (_control.get (), _slots, index, _capacity), false};
+        if (control == _erased && target == _capacity)
+          target = index;
+      }
+
+      bool const reused = target != _capacity;
+      if (!reused)
+        target = index;
+      // The slot is only counted as used once the entry is constructed, so that a throwing constructor
+      // leaves it erased and counted.
+      std::construct_at (_slots + target, std::piecewise_construct, //
+        std::forward_as_tuple (std::forward<K> (key)),
+        std::forward_as_tuple (std::forward<Args> (args)...));
+      if (reused)
+        --_erased_count;
+      _control[target] = tag;
+      ++_size;
+      return {iterator (_control.get (), _slots, target, _capacity), true};
+    }
+
+    /*!
+     * @brief Inserts @a entry, unless its key is present
+     * @return the entry with the same key, and true if it was inserted
+     */
+    std::pair<iterator, bool> insert (value_type const& entry)
+    {
+      return try_emplace (entry.first, entry.second);
+    }
+
+    /*!
+     * @brief Inserts @a entry, unless its key is present
+     * @return the entry with the same key, and true if it was inserted
+     */
+    std::pair<iterator, bool> insert (value_type&& entry)
+    {
+      return try_emplace (std::move (entry.first), std::move (entry.second));
+    }
+
+    /*!
+     * @return the value with key @a key, inserting a value-initialized one if the key is not present
+     */
+    template<class K>
+    Value& operator[] (K&& key)
+    {
+      return try_emplace (std::forward<K> (key)).first->second;
+    }
+
+    /*!
+     * @brief Removes the entry with key @a key
+     * @return the number of removed entries
+     */
+    template<class K>
+      requires (!std::convertible_to<K, const_iterator>)
+    size_type erase (K const& key)
+    {
+      size_type const index = _find (key);
+      if (index == _capacity)
+        return 0;
+      _erase (index);
+      return 1;
+    }
+
+    /*!
+     * @brief Removes the entry at @a position
+     * @return the entry following the removed one
+     */
+    iterator erase (const_iterator position)
+    {
+      _erase (position._index);
+      return {_control.get (), _slots, position._index, _capacity};
+    }
+
+    /*!
+     * @brief Removes all entries, keeping the slots
+     */
+    void clear () noexcept
+    {
+      for (size_type i = 0; i < _capacity; ++i) {
+        if (_control[i] & 0x80)
+          std::destroy_at (_slots + i);
+        _control[i] = _empty;
+      }
+      _size = 0;
+      _erased_count = 0;
+    }
+
+    /*!
+     * @brief Makes room for @a count entries without rehashing
+     */
+    void reserve (size_type count)
+    {
+      size_type capacity = _min_capacity;
+      while (count * 8 > capacity * 7)
+        capacity *= 2;
+      if (capacity > _capacity)
+        _rehash (capacity);
+    }
+
+    void swap (variant_map& other) noexcept
+    {
+      using std::swap;
+      swap (_control, other._control);
+      swap (_slots, other._slots);
+      swap (_capacity, other._capacity);
+      swap (_size, other._size);
+      swap (_erased_count, other._erased_count);
+      swap (_hash, other._hash);
+      swap (_equal, other._equal);
+    }
+
+    //! @}
+
+    // The control byte of a full slot: the high bit set and the top seven bits of the hash.
+    static std::uint8_t _tag (std::size_t hash) noexcept
+    {
+      return static_cast<std::uint8_t> (0x80 | (hash >> (std::numeric_limits<std::size_t>::digits - 7)));
+    }
+
+    template<class K>
+    size_type _find (K const& key) const
+    {
+      if (_size == 0)
+        return _capacity;
+      std::size_t const hash = _hash (key);
+      std::uint8_t const tag = _tag (hash);
+      for (size_type index = hash & (_capacity - 1);; index = (index + 1) & (_capacity - 1)) {
+        std::uint8_t const control = _control[index];
+        if (control == _empty)
+          return _capacity;
+        if (control == tag && _equal (_slots[index].first, key))
+          return index;
+      }
+    }
+
+    void _erase (size_type index) noexcept
+    {
+      std::destroy_at (_slots + index);
+      --_size;
+      // No probe sequence passes through a slot followed by an empty one, so it can become empty too.
+      if (_control[(index + 1) & (_capacity - 1)] == _empty) {
+        _control[index] = _empty;
+      } else {
+        _control[index] = _erased;
+        ++_erased_count;
+      }
+    }
+
+    // Every position is computed before an entry is transferred, so a throwing hash leaves the table
+    // untouched. Entries whose move may throw are copied, and a throwing copy releases the new slots.
+    void _rehash (size_type capacity)
+    {
+      auto control = std::make_unique<std::uint8_t[]> (capacity);
+      auto const positions = std::make_unique_for_overwrite<size_type[]> (_capacity);
+      for (size_type i = 0; i < _capacity; ++i) {
+        if (!(_control[i] & 0x80))
+          continue;
+        std::size_t const hash = _hash (_slots[i].first);
+        size_type index = hash & (capacity - 1);
+        while (control[index] != _empty)
+          index = (index + 1) & (capacity - 1);
+        control[index] = _control[i];
+        positions[i] = index;
+      }
+
+      value_type* slots = std::allocator<value_type> ().allocate (capacity);
+      size_type transferred = 0;
+      auto const transfer = [&] {
+        for (; transferred < _capacity; ++transferred)
+          if (_control[transferred] & 0x80)
+            std::construct_at (slots + positions[transferred], std::move_if_noexcept (_slots[transferred]));
+      };
+#if ML_MOVAR_HAS_EXCEPTIONS
+      try {
+        transfer ();
+      } catch (...) {
+        for (size_type i = 0; i < transferred; ++i)
+          if (_control[i] & 0x80)
+            std::destroy_at (slots + positions[i]);
+        std::allocator<value_type> ().deallocate (slots, capacity);
+        throw;
+      }
+#else
+      transfer ();
+#endif
+
+      size_type const size = _size;
+      _release ();
+      _control = std::move (control);
+      _slots = slots;
+      _capacity = capacity;
+      _size = size;
+      _erased_count = 0;
+    }
+
+    void _release () noexcept
+    {
+      if (_slots == nullptr)
+        return;
+      for (size_type i = 0; i < _capacity; ++i)
+        if (_control[i] & 0x80)
+          std::destroy_at (_slots + i);
+      std::allocator<value_type> ().deallocate (_slots, _capacity);
+      _slots = nullptr;
+      _control.reset ();
+      _size = 0;
+    }
+  };
+} // namespace ml::movar
\ No newline at end of file
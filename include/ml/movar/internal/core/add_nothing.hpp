@@ -30,6 +30,14 @@ namespace ml::internal::movar
   struct add_nothing_impl<variant<Ts...>> : simplify_impl<maybe<Ts...>>
   {};
 
+  template<class... Ts>
+  struct add_nothing_impl<variant_ref<Ts...>> : std::type_identity<maybe_ref<Ts...>>
+  {};
+
+  template<class... Ts>
+  struct add_nothing_impl<maybe_ref<Ts...>> : std::type_identity<maybe_ref<Ts...>>
+  {};
+
   template<Variant T>
   using add_nothing = typename add_nothing_impl<T>::type;
 } // namespace ml::internal::movar
\ No newline at end of file
@@ -30,11 +30,19 @@ namespace ml::internal::movar
   struct alternatives_impl<variant<Ts...>> : type_identity<mp_list<Ts...>>
   {};
 
+  template<class... Ts>
+  struct alternatives_impl<variant_ref<Ts...>> : type_identity<mp_list<Ts&...>>
+  {};
+
+  template<class... Ts>
+  struct alternatives_impl<maybe_ref<Ts...>> : type_identity<mp_list<Ts&...>>
+  {};
+
   template<Variant T>
   using alternatives = typename alternatives_impl<T>::type;
 
   template<Variant T>
-  constexpr inline long size = mp_size<T>::value;
+  constexpr inline long size = mp_size<alternatives<T>>::value;
 
   template<>
   constexpr inline long size<nothing> = 0;
@@ -46,13 +54,32 @@ namespace ml::internal::movar
   concept ContainsIndex = Variant<T> && contains_index<T, I>;
 
   template<Variant T, class E>
-  constexpr inline bool contains_alternative = mp_contains<T, E>::value;
+  constexpr inline bool contains_alternative = mp_contains<alternatives<T>, E>::value;
 
   template<class T, class E>
   concept ContainsAlternative = Variant<T> && contains_alternative<T, E>;
 
   template<Variant T, long I>
     requires ContainsIndex<T, I>
-  using alternative = mp_at_c<T, I>;
+  using alternative = mp_at_c<alternatives<T>, I>;
+
+  template<Variant T, class E>
+    requires ContainsAlternative<T, E>
+  constexpr inline long alternative_index = mp_find<alternatives<T>, E>::value;
+
+  // Reference alternatives: an lvalue of type E can be referred to by the alternative E& or E const&.
+
+  template<class T, class E>
+  concept ContainsReferenceTo = Variant<T> && (contains_alternative<T, E&> || contains_alternative<T, E const&>);
+
+  template<Variant T, class E>
+    requires ContainsReferenceTo<T, E>
+  constexpr inline long reference_index = [] () -> long {
+    if constexpr (contains_alternative<T, E&>) {
+      return alternative_index<T, E&>;
+    } else {
+      return alternative_index<T, E const&>;
+    }
+  }();
 
 } // namespace ml::internal::movar
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include <ml/movar/internal/core/utility.hpp>
+#include <string_view>
+
+namespace ml::internal::movar
+{
+  // A stable, compiler-provided spelling of T, used to order alternatives independently of the order in
+  // which they were encountered. Types whose spelling coincides (e.g. closure types) keep an unspecified
+  // relative order.
+
+  template<class T>
+  constexpr std::string_view type_key () noexcept
+  {
+#if defined(__clang__) || defined(__GNUC__)
+    return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+    return {};
+#endif
+  }
+
+  template<class T1, class T2>
+  using type_key_less = mp_bool<(type_key<T1> () < type_key<T2> ())>;
+
+  template<class List>
+  using sort_by_type_key = mp_sort<List, type_key_less>;
+
+  // Alternative ordering used by join and first_of when merging alternatives of several variants.
+  // The list is only sorted when the option is enabled.
+
+  template<bool Sort, class List>
+  struct canonical_order_impl : type_identity<List>
+  {};
+
+  template<class List>
+  struct canonical_order_impl<true, List> : type_identity<sort_by_type_key<List>>
+  {};
+
+  template<class List>
+  using canonical_order = typename canonical_order_impl<ML_MOVAR_CANONICAL_ORDER, List>::type;
+} // namespace ml::internal::movar
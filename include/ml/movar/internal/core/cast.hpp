@@ -1,5 +1,6 @@
 #pragma once
 #include <ml/movar/internal/core/alternatives.hpp>
+#include <array>
 
 namespace ml::internal::movar
 {
@@ -11,7 +12,7 @@ namespace ml::internal::movar
     } else {
       auto helper = []<class... Ts> (mp_list<Ts...>)
       {
-        return (std::constructible_from<Dest, copy_quals<Source, Ts>> && ...);
+        return (std::constructible_from<Dest, visit_arg<Source, Ts>> && ...);
       };
       return helper (alternatives<std::remove_cvref_t<Source>> {});
     }
@@ -21,4 +22,50 @@ namespace ml::internal::movar
     requires Variant<remove_cvref_t<Source>>
   constexpr inline bool can_implicit_cast = can_explicit_cast<Source, Dest> //
     && (Maybe<remove_cvref_t<Source>> <= !Some<Dest>);
+
+  // True if every alternative of Source is also an alternative of Dest, so that a cast only has to
+  // move the active alternative to a different index.
+  template<Variant Source, Variant Dest>
+  constexpr inline bool can_remap_cast = [] () -> bool {
+    if constexpr (None<Source> || None<Dest>) {
+      return false;
+    } else {
+      auto helper = []<class... Ts> (mp_list<Ts...>)
+      {
+        return (contains_alternative<Dest, Ts> && ...);
+      };
+      return helper (alternatives<Source> {});
+    }
+  }();
+
+  // Index in Dest of each alternative of Source
+  template<Variant Source, Variant Dest>
+    requires (can_remap_cast<Source, Dest>)
+  constexpr inline auto cast_index_map = [] () {
+    auto helper = []<class... Ts> (mp_list<Ts...>)
+    {
+      return std::array<long, sizeof...(Ts)> {long (mp_find<alternatives<Dest>, Ts>::value)...};
+    };
+    return helper (alternatives<Source> {});
+  }();
+
+  // True if the view View can refer to the active alternative of Owner, a possibly const owning variant
+  // whose alternatives are those of View at the same indices.
+  template<Variant View, class Owner>
+  constexpr inline bool can_view = [] () -> bool {
+    using owner = std::remove_const_t<Owner>;
+    if constexpr (!Variant<owner> || None<owner>) {
+      return false;
+    } else if constexpr (size<View> != size<owner>) {
+      return false;
+    } else {
+      auto helper = []<class... Vs, class... Os> (mp_list<Vs...>, mp_list<Os...>)
+      {
+        return ((is_lvalue_reference_v<Vs> && same_as<remove_cvref_t<Vs>, Os> //
+                  && (is_const_v<Owner> <= is_const_v<remove_reference_t<Vs>>))
+          && ...);
+      };
+      return helper (alternatives<View> {}, alternatives<owner> {});
+    }
+  }();
 } // namespace ml::internal::movar
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <ml/movar/internal/core/add_nothing.hpp>
 #include <ml/movar/internal/core/alternatives.hpp>
 #include <ml/movar/internal/core/wrap.hpp>
 
@@ -8,7 +9,7 @@ namespace ml::internal::movar
   constexpr inline bool weak_visitor = [] () -> bool {
     auto helper = []<class... Ts> (mp_list<Ts...>)
     {
-      return (WrapInvocable<Vis, copy_quals<Var, Ts>> && ...);
+      return (WrapInvocable<Vis, visit_arg<Var, Ts>> && ...);
     };
     return helper (alternatives<remove_cvref_t<Var>> {});
   }();
@@ -17,8 +18,8 @@ namespace ml::internal::movar
   constexpr inline bool weak_visitor_r = [] () -> bool {
     auto helper = []<class... Ts> (mp_list<Ts...>)
     {
-      return (WrapInvocable<Vis, copy_quals<Var, Ts>> && ...) //
-        && (is_invocable_r_v<Ret, Vis, copy_quals<Var, Ts>> && ...);
+      return (WrapInvocable<Vis, visit_arg<Var, Ts>> && ...) //
+        && (is_invocable_r_v<Ret, Vis, visit_arg<Var, Ts>> && ...);
     };
     return helper (alternatives<remove_cvref_t<Var>> {});
   }();
@@ -49,4 +50,60 @@ namespace ml::internal::movar
 
   template<class Fn>
   concept Lazy = WrapInvocable<Fn>;
+
+  template<class T>
+  constexpr inline bool is_filter = false;
+
+  template<class P>
+  constexpr inline bool is_filter<filter<P>> = true;
+
+  template<class T>
+  constexpr inline bool is_all_of = false;
+
+  template<class P1, class P2>
+  constexpr inline bool is_all_of<all_of<P1, P2>> = true;
+
+  template<class T>
+  constexpr inline bool is_compose = false;
+
+  template<class F, class G>
+  constexpr inline bool is_compose<compose<F, G>> = true;
+
+  template<class T>
+  constexpr inline bool is_static_variant = false;
+
+  template<long Index, class... Ts>
+  constexpr inline bool is_static_variant<static_variant<Index, Ts...>> = true;
+
+  // Argument received by the stages of a lazy pipeline invoked with Arg: a static_variant stands for its
+  // active alternative, which is passed with the qualifiers of Arg.
+  template<class Arg>
+  struct pipeline_arg_impl : type_identity<Arg&&>
+  {};
+
+  template<class Arg>
+    requires is_static_variant<remove_cvref_t<Arg>>
+  struct pipeline_arg_impl<Arg> : type_identity<copy_quals<Arg, typename remove_cvref_t<Arg>::value_type>>
+  {};
+
+  template<class Arg>
+  using pipeline_arg = typename pipeline_arg_impl<Arg>::type;
+
+  template<class Pred, class Arg>
+  constexpr inline bool filter_predicate = std::predicate<Pred, Arg>;
+
+  // A fused filter behaves like two chained filters: with a variant argument the second predicate
+  // sees the alternatives of the first filter's result.
+  template<class P1, class P2, class Arg>
+  constexpr inline bool filter_predicate<all_of<P1, P2> const&, Arg> = [] () -> bool {
+    if constexpr (Variant<remove_cvref_t<Arg>>) {
+      using first_result = add_nothing<wrap_result<Arg>>;
+      return filter_predicate<P1 const&, Arg> && weak_visitor<filter<P2> const&, first_result>;
+    } else {
+      return filter_predicate<P1 const&, Arg> && filter_predicate<P2 const&, Arg>;
+    }
+  }();
+
+  template<class Pred, class Arg>
+  concept FilterPredicate = filter_predicate<Pred, Arg>;
 } // namespace ml::internal::movar
\ No newline at end of file
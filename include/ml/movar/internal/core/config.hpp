@@ -0,0 +1,59 @@
+#pragma once
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#  define ML_MOVAR_HAS_EXCEPTIONS 1
+#else
+#  define ML_MOVAR_HAS_EXCEPTIONS 0
+#endif
+
+// Failed conversions and accesses can only throw when exceptions are enabled.
+
+#if !defined(ML_MOVAR_THROWING_CAST)
+#  define ML_MOVAR_THROWING_CAST ML_MOVAR_HAS_EXCEPTIONS
+#elif ML_MOVAR_THROWING_CAST && !ML_MOVAR_HAS_EXCEPTIONS
+#  undef ML_MOVAR_THROWING_CAST
+#  define ML_MOVAR_THROWING_CAST 0
+#endif
+
+#if !defined(ML_MOVAR_THROWING_ACCESS)
+#  define ML_MOVAR_THROWING_ACCESS ML_MOVAR_HAS_EXCEPTIONS
+#elif ML_MOVAR_THROWING_ACCESS && !ML_MOVAR_HAS_EXCEPTIONS
+#  undef ML_MOVAR_THROWING_ACCESS
+#  define ML_MOVAR_THROWING_ACCESS 0
+#endif
+
+// Opt-in: order merged alternatives by type key rather than by first occurrence.
+
+#if !defined(ML_MOVAR_CANONICAL_ORDER)
+#  define ML_MOVAR_CANONICAL_ORDER 0
+#endif
+
+// Opt-in: move rarely taken branches, such as visiting nothing, out of line to reduce code size.
+
+#if !defined(ML_MOVAR_OUTLINE_COLD_PATHS)
+#  define ML_MOVAR_OUTLINE_COLD_PATHS 0
+#endif
+
+#if ML_MOVAR_OUTLINE_COLD_PATHS && defined(__GNUC__)
+#  define ML_MOVAR_COLD [[gnu::cold, gnu::noinline]]
+#elif ML_MOVAR_OUTLINE_COLD_PATHS && defined(_MSC_VER)
+#  define ML_MOVAR_COLD __declspec (noinline)
+#else
+#  define ML_MOVAR_COLD
+#endif
+
+// Tag scans of columnar containers use SSE2 when the target has it, and a scalar loop otherwise.
+
+#if !defined(ML_MOVAR_HAS_SSE2)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define ML_MOVAR_HAS_SSE2 1
+#  else
+#    define ML_MOVAR_HAS_SSE2 0
+#  endif
+#endif
+
+#ifdef __GNUC__
+#  define ML_MOVAR_UNREACHABLE __builtin_unreachable ()
+#else
+#  define ML_MOVAR_UNREACHABLE __assume (false)
+#endif
@@ -1,10 +1,13 @@
 #pragma once
 #include <ml/movar/internal/core/add_nothing.hpp>
 #include <ml/movar/internal/core/alternatives.hpp>
+#include <ml/movar/internal/core/canonical.hpp>
 #include <ml/movar/internal/core/cast.hpp>
+#include <ml/movar/internal/core/config.hpp>
 #include <ml/movar/internal/core/concepts.hpp>
 #include <ml/movar/internal/core/detect.hpp>
 #include <ml/movar/internal/core/first_of.hpp>
+#include <ml/movar/internal/core/flatten.hpp>
 #include <ml/movar/internal/core/fwd.hpp>
 #include <ml/movar/internal/core/join.hpp>
 #include <ml/movar/internal/core/simplify.hpp>
@@ -11,7 +11,9 @@ namespace ml::internal::movar
     EITHER,
     VARIANT,
     OPTION,
-    MAYBE
+    MAYBE,
+    VARIANT_REF,
+    MAYBE_REF
   };
 
   template<class T>
@@ -35,17 +37,25 @@ namespace ml::internal::movar
   template<class... Ts>
   constexpr inline variant_tag detect<maybe<Ts...>> = variant_tag::MAYBE;
 
+  template<class... Ts>
+  constexpr inline variant_tag detect<variant_ref<Ts...>> = variant_tag::VARIANT_REF;
+
+  template<class... Ts>
+  constexpr inline variant_tag detect<maybe_ref<Ts...>> = variant_tag::MAYBE_REF;
+
   template<class T>
   constexpr inline bool detect_nothing = detect<T> == variant_tag::NOTHING;
 
   template<class T>
   constexpr inline bool detect_some = (detect<T> == variant_tag::JUST) //
     || (detect<T> == variant_tag::EITHER)                              //
-    || (detect<T> == variant_tag::VARIANT);
+    || (detect<T> == variant_tag::VARIANT)                             //
+    || (detect<T> == variant_tag::VARIANT_REF);
 
   template<class T>
   constexpr inline bool detect_maybe = (detect<T> == variant_tag::OPTION) //
-    || (detect<T> == variant_tag::MAYBE);
+    || (detect<T> == variant_tag::MAYBE)                                  //
+    || (detect<T> == variant_tag::MAYBE_REF);
 } // namespace ml::internal::movar
 
 namespace ml::movar
@@ -1,37 +1,27 @@
 #pragma once
-#include <ml/movar/internal/core/simplify.hpp>
+#include <ml/movar/internal/core/join.hpp>
 
 namespace ml::internal::movar
 {
   template<Variant... Ts>
     requires (sizeof...(Ts) > 0)
-  struct first_of_impl;
-
-  template<Variant T1, Variant... Ts>
-  struct first_of_impl<T1, Ts...> : first_of_impl<T1, typename first_of_impl<Ts...>::type>
-  {};
-
-  template<Variant T>
-  struct first_of_impl<T> : simplify_impl<T>
-  {};
-
-  template<Variant T1, Variant T2>
-  struct first_of_impl<T1, T2>
+  struct first_of_impl
   {
     static constexpr auto _deduce ()
     {
-      if constexpr (None<T1>) {
-        return simplify_impl<T2> {};
-      } else if constexpr (None<T2>) {
-        return simplify_impl<T1> {};
-      } else if constexpr (Some<T1>) {
-        return simplify_impl<T1> {};
-      } else if constexpr (Some<T2>) {
-        using result = mp_rename<mp_set_union<mp_list<>, T1, T2>, variant>;
-        return simplify_impl<result> {};
+      using values = mp_remove_if<mp_list<Ts...>, is_none>;
+      constexpr long first_some = mp_find_if<values, is_some>::value;
+      constexpr bool maybe_null = first_some == mp_size<values>::value;
+
+      // the variants after the first one that always has a value are never taken
+      using reachable = mp_take_c<values, (maybe_null ? first_some : first_some + 1)>;
+
+      if constexpr (mp_size<reachable>::value == 0) {
+        return type_identity<nothing> {};
+      } else if constexpr (mp_size<reachable>::value == 1) {
+        return simplify_impl<mp_front<reachable>> {};
       } else {
-        using result = mp_rename<mp_set_union<mp_list<>, T1, T2>, maybe>;
-        return simplify_impl<result> {};
+        return deduce_simplified_impl<maybe_null, merge_alternatives<reachable>> {};
       }
     }
 
@@ -0,0 +1,70 @@
+#pragma once
+#include <ml/movar/internal/core/join.hpp>
+#include <ml/movar/internal/core/wrap.hpp>
+#include <utility>
+
+namespace ml::internal::movar
+{
+  // The leaves of T: T itself if it is not a Variant, otherwise the leaves of its alternatives in order,
+  // preceded by nothing if T can be empty. Each leaf has a flat index.
+
+  template<class T>
+  struct leaves_impl : type_identity<mp_list<T>>
+  {};
+
+  template<class T>
+  using leaves = typename leaves_impl<T>::type;
+
+  template<class T>
+    requires Variant<remove_cvref_t<T>>
+  struct leaves_impl<T>
+  {
+    using unqual = remove_cvref_t<T>;
+    using nested = mp_apply<mp_append, mp_transform<leaves, alternatives<unqual>>>;
+    using type = conditional_t<Maybe<unqual> || None<unqual>, mp_push_front<nested, nothing>, nested>;
+  };
+
+  template<class T>
+  constexpr inline long leaf_count = mp_size<leaves<T>>::value;
+
+  // Flat index of the first leaf of the alternative at I.
+  template<Variant T, long I>
+  constexpr inline long leaf_offset = [] () -> long {
+    auto helper = []<std::size_t... Js> (std::index_sequence<Js...>)
+    {
+      return (leaf_count<alternative<T, Js>> + ... + 0);
+    };
+    return long (Maybe<T> || None<T>) + helper (std::make_index_sequence<I> {});
+  }();
+
+  // Index of the alternative that contains the leaf at flat index K, which is not nothing.
+  template<Variant T, long K>
+  constexpr inline long leaf_owner = [] () -> long {
+    auto helper = []<std::size_t... Is> (std::index_sequence<Is...>)
+    {
+      return (long (leaf_offset<T, Is + 1> <= K) + ... + 0);
+    };
+    return helper (std::make_index_sequence<size<T> - 1> {});
+  }();
+
+  // True if some alternative of T is itself a Variant.
+  template<Variant T>
+  constexpr inline bool is_nested = leaf_count<T> != size<T> + long (Maybe<T> || None<T>);
+
+  template<Variant T>
+  using flatten_result = mp_apply<join, mp_transform<wrap_result, leaves<T>>>;
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*!
+   * @brief The variant whose alternatives are the leaves of @a T
+   * @ingroup Variant
+   *
+   * Alternatives of @a T that are themselves variants are replaced by their alternatives, recursively,
+   * and the result can be empty if any nested variant can be empty.
+   * For example, the flattened type of `variant<A, either<B, C>, option<D>>` is `maybe<A, B, C, D>`.
+   */
+  template<Variant T>
+  using flatten_t = internal::movar::flatten_result<T>;
+} // namespace ml::movar
\ No newline at end of file
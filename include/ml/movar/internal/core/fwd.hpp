@@ -8,55 +8,6 @@ namespace ml::internal::movar
 
   template<class U, class T>
   inline void get (T&&) = delete;
-
-  // hide from ADL
-  namespace impl
-  {
-    template<class To, int..., class From>
-    static constexpr To cast (From&& from);
-
-    template<class Arg>
-    static constexpr auto wrap (Arg&& arg);
-
-    template<class Fn, class... Args>
-    static constexpr auto wrap_invoke (Fn&& fn, Args&&... args);
-
-    template<class Vis, class Var>
-    static constexpr auto weak_visit (Vis&& vis, Var&& var);
-
-    template<class R, class Vis, class Var>
-    static constexpr auto weak_visit_r (Vis&& vis, Var&& var);
-
-    template<class Vis, class Var>
-    static constexpr auto visit (Vis&& vis, Var&& var);
-
-    template<class R, class Vis, class Var>
-    static constexpr auto visit_r (Vis&& vis, Var&& var);
-
-    template<class Var, class Fn>
-    static constexpr auto map (Var&& var, Fn&& fn);
-
-    template<class Var, class Fn>
-    static constexpr auto match (Var&& var, Fn&& fn);
-
-    template<class Var, class Fn, class Default>
-    static constexpr auto map_or (Var&& var, Fn&& fn, Default&& def);
-
-    template<class Var, class Fn, class Default>
-    static constexpr auto map_or_else (Var&& var, Fn&& fn, Default&& lazy);
-
-    template<class Var, class Default>
-    static constexpr auto or_else (Var&& var, Default&& lazy);
-
-    template<class Var>
-    static constexpr auto take (Var&&);
-
-    template<class Lhs, class Rhs>
-    static constexpr auto pipe_sequence (Lhs&& lhs, Rhs&& rhs);
-
-    template<class Lhs, class Rhs>
-    static constexpr auto pipe_fork (Lhs&& lhs, Rhs&& rhs);
-  } // namespace impl
 } // namespace ml::internal::movar
 
 namespace ml::movar
@@ -80,6 +31,18 @@ namespace ml::movar
     requires (sizeof...(Ts) > 0)
   struct maybe;
 
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct variant_ref;
+
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct maybe_ref;
+
+  template<long Index, class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct static_variant;
+
   template<std::move_constructible... Ts>
   struct sequence;
 
@@ -92,6 +55,9 @@ namespace ml::movar
 
   template<class T>
   struct filter_on_type;
+
+  template<class Var, class Fn>
+  struct deferred_map;
 } // namespace ml::movar
 
 namespace ml::internal::movar
@@ -99,12 +65,94 @@ namespace ml::internal::movar
   using ml::movar::either;
   using ml::movar::just;
   using ml::movar::maybe;
+  using ml::movar::maybe_ref;
   using ml::movar::nothing;
   using ml::movar::option;
+  using ml::movar::static_variant;
   using ml::movar::variant;
+  using ml::movar::variant_ref;
 
   using ml::movar::filter;
   using ml::movar::filter_on_type;
   using ml::movar::fork;
   using ml::movar::sequence;
+
+  template<std::move_constructible P1, std::move_constructible P2>
+  struct all_of;
+
+  template<std::move_constructible F, std::move_constructible G>
+  struct compose;
+
+  // hide from ADL
+  namespace impl
+  {
+    template<class To, int..., class From>
+    static constexpr To cast (From&& from);
+
+    template<class To, int..., class From>
+    static constexpr option<To> try_cast (From&& from);
+
+    template<class Arg>
+    static constexpr auto wrap (Arg&& arg);
+
+    template<class Fn, class... Args>
+    static constexpr auto wrap_invoke (Fn&& fn, Args&&... args);
+
+    template<class R, class Fn, class... Args>
+    static constexpr R wrap_invoke_r (Fn&& fn, Args&&... args);
+
+    template<class Vis, class Var>
+    static constexpr auto weak_visit (Vis&& vis, Var&& var);
+
+    template<class R, class Vis, class Var>
+    static constexpr auto weak_visit_r (Vis&& vis, Var&& var);
+
+    template<class Vis, class Var>
+    static constexpr auto visit (Vis&& vis, Var&& var);
+
+    template<class R, class Vis, class Var>
+    static constexpr auto visit_r (Vis&& vis, Var&& var);
+
+    template<class Var, class Fn>
+    static constexpr auto map (Var&& var, Fn&& fn);
+
+    template<class Var, class Fn>
+    static constexpr auto match (Var&& var, Fn&& fn);
+
+    template<class Var, class Fn, class Default>
+    static constexpr auto map_or (Var&& var, Fn&& fn, Default&& def);
+
+    template<class Var, class Fn, class Default>
+    static constexpr auto map_or_else (Var&& var, Fn&& fn, Default&& lazy);
+
+    template<class Var, class Default>
+    static constexpr auto or_else (Var&& var, Default&& lazy);
+
+    template<class Var>
+    static constexpr auto take (Var&&);
+
+    template<class Var, class Fn>
+    static constexpr auto deep_match (Var&& var, Fn&& fn);
+
+    template<class Self, class Fn>
+    static constexpr auto static_map (Self&& self, Fn&& fn);
+
+    template<class Self, class Fn>
+    static constexpr auto static_match (Self&& self, Fn&& fn);
+
+    template<class Self, class Default>
+    static constexpr auto static_or_else (Self&& self, Default&& lazy);
+
+    template<class Arg>
+    static constexpr decltype (auto) unwrap_static (Arg&& arg) noexcept;
+
+    template<class Lhs, class Rhs>
+    static constexpr auto pipe_sequence (Lhs&& lhs, Rhs&& rhs);
+
+    template<class Lhs, class Rhs>
+    static constexpr auto pipe_fork (Lhs&& lhs, Rhs&& rhs);
+
+    template<class Lhs, class Rhs>
+    static constexpr auto fuse (Lhs&& lhs, Rhs&& rhs);
+  } // namespace impl
 } // namespace ml::internal::movar
\ No newline at end of file
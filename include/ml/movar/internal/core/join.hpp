@@ -1,35 +1,48 @@
 #pragma once
 #include <ml/movar/internal/core/add_nothing.hpp>
+#include <ml/movar/internal/core/alternatives.hpp>
+#include <ml/movar/internal/core/canonical.hpp>
 
 namespace ml::internal::movar
 {
-  template<Variant... Ts>
-    requires (sizeof...(Ts) > 0)
-  struct join_impl;
+  template<class T>
+  using is_none = mp_bool<None<T>>;
 
-  template<Variant T>
-  struct join_impl<T> : simplify_impl<T>
-  {};
+  template<class T>
+  using is_some = mp_bool<Some<T>>;
 
-  template<Variant T, Variant... Ts>
-  struct join_impl<T, Ts...> : join_impl<T, typename join_impl<Ts...>::type>
-  {};
+  // The alternatives of every variant in List, without duplicates, in order of first appearance.
+  // Computed from the concatenation of all alternative lists in a single pass, so that merging N
+  // variants does not instantiate N intermediate results.
+  template<class List>
+  struct merge_alternatives_impl;
 
-  template<Variant T1, Variant T2>
-  struct join_impl<T1, T2>
+  template<class... Ts>
+  struct merge_alternatives_impl<mp_list<Ts...>>
+  {
+    using type = canonical_order<mp_unique<mp_append<mp_list<>, alternatives<Ts>...>>>;
+  };
+
+  template<class List>
+  using merge_alternatives = typename merge_alternatives_impl<List>::type;
+
+  template<Variant... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct join_impl
   {
     static constexpr auto _deduce ()
     {
-      if constexpr (None<T1>) {
-        return add_nothing_impl<T2> {};
-      } else if constexpr (None<T2>) {
-        return add_nothing_impl<T1> {};
-      } else if constexpr (Maybe<T1> || Maybe<T2>) {
-        using result = mp_rename<mp_set_union<mp_list<>, T1, T2>, maybe>;
-        return simplify_impl<result> {};
+      using values = mp_remove_if<mp_list<Ts...>, is_none>;
+      constexpr bool maybe_null = ((None<Ts> || Maybe<Ts>) || ...);
+
+      if constexpr (mp_size<values>::value == 0) {
+        return type_identity<nothing> {};
+      } else if constexpr (mp_size<values>::value == 1 && sizeof...(Ts) == 1) {
+        return simplify_impl<mp_front<values>> {};
+      } else if constexpr (mp_size<values>::value == 1) {
+        return add_nothing_impl<mp_front<values>> {};
       } else {
-        using result = mp_rename<mp_set_union<mp_list<>, T1, T2>, variant>;
-        return simplify_impl<result> {};
+        return deduce_simplified_impl<maybe_null, merge_alternatives<values>> {};
       }
     }
 
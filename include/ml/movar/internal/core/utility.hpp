@@ -1,7 +1,9 @@
 #pragma once
-#pragma once
+#include <ml/movar/internal/core/config.hpp>
 #include <concepts>
 #include <functional>
+#include <stdexcept>
+#include <variant>
 
 #include <boost/mp11/algorithm.hpp>
 #include <boost/mp11/bind.hpp>
@@ -21,17 +23,27 @@ namespace ml::movar
 
 namespace ml::internal::movar
 {
+  using boost::mp11::mp_all_of;
+  using boost::mp11::mp_append;
   using boost::mp11::mp_apply;
   using boost::mp11::mp_at_c;
   using boost::mp11::mp_bind_front;
+  using boost::mp11::mp_bool;
   using boost::mp11::mp_contains;
+  using boost::mp11::mp_find;
+  using boost::mp11::mp_find_if;
+  using boost::mp11::mp_front;
   using boost::mp11::mp_list;
   using boost::mp11::mp_push_front;
   using boost::mp11::mp_remove;
+  using boost::mp11::mp_remove_if;
   using boost::mp11::mp_rename;
   using boost::mp11::mp_set_union;
   using boost::mp11::mp_size;
+  using boost::mp11::mp_sort;
+  using boost::mp11::mp_take_c;
   using boost::mp11::mp_transform;
+  using boost::mp11::mp_unique;
   using std::add_const_t;
   using std::add_lvalue_reference_t;
   using std::add_rvalue_reference_t;
@@ -79,4 +91,33 @@ namespace ml::internal::movar
 
   template<class T, class U>
   using copy_quals = typename copy_quals_impl<T, U>::type;
+
+  // Argument passed to a visitor for the alternative U of a variant of type T: reference alternatives
+  // are passed as they are, other alternatives get the qualifiers of T.
+  template<class T, class U>
+  using visit_arg = conditional_t<std::is_reference_v<U>, U, copy_quals<T, U>>;
+
+  /*
+   * Called when a conversion to a variant that cannot be empty finds ml::movar::nothing.
+   */
+  [[noreturn]] ML_MOVAR_COLD inline void bad_cast ()
+  {
+#if ML_MOVAR_THROWING_CAST
+    throw std::runtime_error ("Bad variant cast");
+#else
+    ML_MOVAR_UNREACHABLE;
+#endif
+  }
+
+  /*
+   * Called when a checked getter is used with an alternative that is not active.
+   */
+  [[noreturn]] ML_MOVAR_COLD inline void bad_access ()
+  {
+#if ML_MOVAR_THROWING_ACCESS
+    throw std::bad_variant_access ();
+#else
+    ML_MOVAR_UNREACHABLE;
+#endif
+  }
 } // namespace ml::internal::movar
\ No newline at end of file
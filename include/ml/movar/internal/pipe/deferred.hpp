@@ -0,0 +1,66 @@
+#pragma once
+#include <ml/movar/internal/type/nothing.hpp>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::deferred_map
+   * @ingroup LazyPipeline
+   * @brief A chain of maps over a variant, evaluated with a single visit
+   *
+   * Returned by the `lazy_map` member of every variant. Each call to ml::movar::deferred_map::map fuses
+   * the new function with the previous ones instead of visiting, and ml::movar::deferred_map::eval visits
+   * the variant once with the fused function.
+   *
+   * `v.lazy_map(f).map(g).eval()` returns the same type and value as `v.map(f).map(g)`, without
+   * materializing the intermediate variant.
+   *
+   * @a Var is an lvalue reference when the deferred map was created from an lvalue, in which case the
+   * variant must outlive the deferred map.
+   */
+  template<class Var, class Fn>
+  struct deferred_map
+  {
+    Var _var;
+    Fn _fn;
+
+    /*!
+     * @brief Appends @a vis to the chain
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) const&
+    {
+      namespace impl = ml::internal::movar::impl;
+      using fused = decltype (impl::fuse (_fn, std::move (vis)));
+      return deferred_map<Var, fused> {_var, impl::fuse (_fn, std::move (vis))};
+    }
+
+    /*!
+     * @brief Appends @a vis to the chain
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) &&
+    {
+      namespace impl = ml::internal::movar::impl;
+      using fused = decltype (impl::fuse (std::move (_fn), std::move (vis)));
+      return deferred_map<Var, fused> {std::forward<Var> (_var), impl::fuse (std::move (_fn), std::move (vis))};
+    }
+
+    /*!
+     * @brief Visits the variant once with the fused chain
+     */
+    [[nodiscard]] constexpr auto eval () const&
+      requires (ml::internal::movar::WeakVisitor<Fn const&, Var const&>)
+    {
+      return ml::internal::movar::impl::map (_var, _fn);
+    }
+
+    /*!
+     * @brief Visits the variant once with the fused chain
+     */
+    [[nodiscard]] constexpr auto eval () &&
+      requires (ml::internal::movar::WeakVisitor<Fn&&, Var&&>)
+    {
+      return ml::internal::movar::impl::map (std::forward<Var> (_var), std::move (_fn));
+    }
+  };
+} // namespace ml::movar
\ No newline at end of file
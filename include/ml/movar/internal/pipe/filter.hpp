@@ -32,17 +32,29 @@ namespace ml::movar
     {}
 
     template<class Arg>
-    [[nodiscard]] constexpr auto operator() (Arg&& arg) const        //
-      noexcept (std::is_nothrow_invocable_v<Predicate const&, Arg&>) //
-      requires (std::predicate<Predicate const&, Arg&>)              //
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const                                       //
+      noexcept (std::is_nothrow_invocable_v<Predicate const&, ml::internal::movar::pipeline_arg<Arg>&>) //
+      requires (ml::internal::movar::FilterPredicate<Predicate const&,                                //
+        ml::internal::movar::pipeline_arg<Arg>&>)
     {
       using ml::internal::movar::add_nothing;
       using ml::internal::movar::wrap_result;
-      using result = add_nothing<wrap_result<Arg>>;
       namespace impl = ml::internal::movar::impl;
-      if (std::invoke (_pred, arg))
-        return result (impl::wrap (std::forward<Arg> (arg)));
-      return result ();
+      if constexpr (ml::internal::movar::is_static_variant<std::remove_cvref_t<Arg>>) {
+        return (*this) (impl::unwrap_static (std::forward<Arg> (arg)));
+      } else if constexpr (ml::internal::movar::is_all_of<Predicate> && Variant<std::remove_cvref_t<Arg>>) {
+        return filter<decltype (_pred._first)> (_pred._first) (std::forward<Arg> (arg)) //
+          .map (filter<decltype (_pred._second)> (_pred._second));
+      } else {
+        using result = add_nothing<wrap_result<Arg>>;
+        if (std::invoke (_pred, arg)) {
+          if constexpr (Variant<std::remove_cvref_t<Arg>>)
+            return result (std::forward<Arg> (arg));
+          else
+            return result (std::in_place_index<0>, std::forward<Arg> (arg));
+        }
+        return result ();
+      }
     }
 
     template<class Other>
@@ -99,6 +111,14 @@ namespace ml::movar
       return impl::wrap (std::forward<Arg> (arg));
     }
 
+    template<class Arg>
+      requires (ml::internal::movar::is_static_variant<std::remove_cvref_t<Arg>>)
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const //
+    {
+      namespace impl = ml::internal::movar::impl;
+      return (*this) (impl::unwrap_static (std::forward<Arg> (arg)));
+    }
+
     template<class Other>
     [[nodiscard]] constexpr auto operator>> (Other&& other) const
     {
@@ -26,11 +26,11 @@ namespace ml::movar
     // ---
 
     template<class Arg>
-    [[nodiscard]] constexpr auto operator() (Arg&& arg) const       //
-      requires (ml::internal::movar::WrapInvocable<T1 const&, Arg>) //
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const                                   //
+      requires (ml::internal::movar::WrapInvocable<T1 const&, ml::internal::movar::pipeline_arg<Arg>>) //
     {
       namespace impl = ml::internal::movar::impl;
-      return impl::wrap_invoke (_fn, std::forward<Arg> (arg));
+      return impl::wrap_invoke (_fn, impl::unwrap_static (std::forward<Arg> (arg)));
     }
 
     template<class Other>
@@ -75,15 +75,19 @@ namespace ml::movar
     {}
 
     template<class Arg>
-    [[nodiscard]] constexpr auto operator() (Arg&& arg) const       //
-      requires (ml::internal::movar::WrapInvocable<T1 const&, Arg&> //
-        || ml::internal::movar::WrapInvocable<T2 const&, Arg&>)     //
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const                                    //
+      requires (ml::internal::movar::WrapInvocable<T1 const&, ml::internal::movar::pipeline_arg<Arg>&> //
+        || ml::internal::movar::WrapInvocable<T2 const&, ml::internal::movar::pipeline_arg<Arg>&>)     //
     {
       using ml::internal::movar::WrapInvocable;
       namespace impl = ml::internal::movar::impl;
-      if constexpr (WrapInvocable<T1 const&, Arg&> && WrapInvocable<T2 const&, Arg&>) {
-        return impl::wrap_invoke (_first, arg) //
-          .or_else (std::bind_front (_second, std::forward<Arg> (arg)));
+      if constexpr (ml::internal::movar::is_static_variant<std::remove_cvref_t<Arg>>) {
+        return (*this) (impl::unwrap_static (std::forward<Arg> (arg)));
+      } else if constexpr (WrapInvocable<T1 const&, Arg&> && WrapInvocable<T2 const&, Arg&>) {
+        // the second branch refers to the argument instead of binding a copy of it
+        return impl::wrap_invoke (_first, arg).or_else ([this, &arg] () -> decltype (auto) {
+          return std::invoke (_second, std::forward<Arg> (arg));
+        });
       } else if constexpr (WrapInvocable<T1 const&, Arg>) {
         return impl::wrap_invoke (_first, std::forward<Arg> (arg));
       } else if constexpr (WrapInvocable<T2 const&, Arg>) {
@@ -1,4 +1,5 @@
 #pragma once
+#include <ml/movar/internal/pipe/deferred.hpp>
 #include <ml/movar/internal/pipe/filter.hpp>
 #include <ml/movar/internal/pipe/fork.hpp>
 #include <ml/movar/internal/pipe/sequence.hpp>
@@ -19,7 +19,7 @@ namespace ml::movar
     [[nodiscard]] constexpr auto operator() (T&& value) const //
     {
       namespace impl = ml::internal::movar::impl;
-      return impl::wrap (std::forward<T> (value));
+      return impl::wrap (impl::unwrap_static (std::forward<T> (value)));
     }
 
     template<class Other>
@@ -64,11 +64,11 @@ namespace ml::movar
     // ---
 
     template<class Arg>
-    [[nodiscard]] constexpr auto operator() (Arg&& arg) const       //
-      requires (ml::internal::movar::WrapInvocable<T1 const&, Arg>) //
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const                                   //
+      requires (ml::internal::movar::WrapInvocable<T1 const&, ml::internal::movar::pipeline_arg<Arg>>) //
     {
       namespace impl = ml::internal::movar::impl;
-      return impl::wrap_invoke (_fn, std::forward<Arg> (arg));
+      return impl::wrap_invoke (_fn, impl::unwrap_static (std::forward<Arg> (arg)));
     }
 
     template<class Other>
@@ -116,12 +116,13 @@ namespace ml::movar
     // ---
 
     template<class Arg>
-    [[nodiscard]] constexpr auto operator() (Arg&& arg) const&     //
-      requires (ml::internal::movar::WrapInvocable<T1 const&, Arg> //
-          && ml::internal::movar::WeakVisitor<T2 const&, ml::internal::movar::wrap_invoke_result<T1 const&, Arg>>) //
+    [[nodiscard]] constexpr auto operator() (Arg&& arg) const&                                   //
+      requires (ml::internal::movar::WrapInvocable<T1 const&, ml::internal::movar::pipeline_arg<Arg>> //
+          && ml::internal::movar::WeakVisitor<T2 const&,
+            ml::internal::movar::wrap_invoke_result<T1 const&, ml::internal::movar::pipeline_arg<Arg>>>) //
     {
       namespace impl = ml::internal::movar::impl;
-      return impl::wrap_invoke (_fn1, std::forward<Arg> (arg)) //
+      return impl::wrap_invoke (_fn1, impl::unwrap_static (std::forward<Arg> (arg))) //
         .map (_fn2);
     }
 
@@ -0,0 +1,304 @@
+#pragma once
+#include <ml/movar/internal/container/variant_column.hpp>
+#include <ml/movar/internal/serialize/bitwise.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ml::internal::movar
+{
+  /*
+   * An archive is a header, a table with the offset and length of every alternative section, the
+   * tag of every row, the position of every row in its section, and one section per alternative
+   * holding its values as they are in memory. Offsets are relative to the start of the archive and
+   * every section starts at a multiple of archive_alignment.
+   */
+  struct archive_header
+  {
+    std::array<char, 8> magic;
+    std::uint32_t byte_order;
+    std::uint32_t version;
+    std::uint64_t layout;
+    std::uint64_t rows;
+    std::uint64_t alternatives;
+    std::uint64_t tags;
+    std::uint64_t slots;
+  };
+
+  struct archive_section
+  {
+    std::uint64_t offset;
+    std::uint64_t count;
+  };
+
+  constexpr std::array<char, 8> archive_magic {'m', 'o', 'v', 'a', 'r', 'c', 'h', '\0'};
+  constexpr std::uint32_t archive_byte_order = 0x01020304;
+  constexpr std::uint32_t archive_version = 1;
+  constexpr std::size_t archive_alignment = 64;
+
+  constexpr std::uint64_t archive_align (std::uint64_t offset) noexcept
+  {
+    return (offset + archive_alignment - 1) / archive_alignment * archive_alignment;
+  }
+
+  // Identifies the size and alignment of every alternative, so that an archive is not opened with
+  // types of a different layout.
+  template<class... Ts>
+  constexpr std::uint64_t archive_layout () noexcept
+  {
+    std::uint64_t layout = hash_mix (static_cast<long> (sizeof...(Ts)), 0);
+    ((layout = hash_mix (static_cast<long> (sizeof (Ts)), layout ^ alignof (Ts))), ...);
+    return layout;
+  }
+
+  // Values are read in place from the archive, possibly by another process, so they must hold no
+  // pointers, like the values that binary_writer copies as they are.
+  template<class T>
+  concept Archivable = pointer_free<T> && !Variant<T>;
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*!
+   * @brief Encodes @a column as an archive that ml::movar::variant_archive reads in place
+   * @ingroup Serialization
+   *
+   * The tags, positions and values of the column are copied as they are, so the archive can only be
+   * read on a platform with the same byte order and layout of @a Ts.
+   */
+  template<class... Ts>
+    requires (internal::movar::Archivable<Ts> && ...)
+  std::vector<std::byte> make_archive (variant_column<Ts...> const& column)
+  {
+    using internal::movar::archive_align;
+    constexpr std::size_t alternatives = sizeof...(Ts);
+
+    internal::movar::archive_header header {
+      .magic = internal::movar::archive_magic,
+      .byte_order = internal::movar::archive_byte_order,
+      .version = internal::movar::archive_version,
+      .layout = internal::movar::archive_layout<Ts...> (),
+      .rows = column.size (),
+      .alternatives = alternatives,
+      .tags = 0,
+      .slots = 0,
+    };
+    std::array<internal::movar::archive_section, alternatives> sections {};
+
+    std::uint64_t end = sizeof (header) + sizeof (sections);
+    header.tags = archive_align (end);
+    end = header.tags + column._tags.size ();
+    header.slots = archive_align (end);
+    end = header.slots + column._slots.size () * sizeof (std::uint32_t);
+    [&]<std::size_t... I> (std::index_sequence<I...>) {
+      ((sections[I] = {archive_align (end), std::get<I> (column._payloads).size ()},
+         end = sections[I].offset + sections[I].count * sizeof (Ts)),
+        ...);
+    }(std::index_sequence_for<Ts...> {});
+
+    std::vector<std::byte> archive (end);
+    auto const copy = [&archive] (std::uint64_t offset, void const* data, std::size_t size) {
+      if (size != 0)
+        std::memcpy (archive.data () + offset, data, size);
+    };
+    copy (0, &header, sizeof (header));
+    copy (sizeof (header), sections.data (), sizeof (sections));
+    copy (header.tags, column._tags.data (), column._tags.size ());
+    copy (header.slots, column._slots.data (), column._slots.size () * sizeof (std::uint32_t));
+    [&]<std::size_t... I> (std::index_sequence<I...>) {
+      (copy (sections[I].offset, std::get<I> (column._payloads).data (), sections[I].count * sizeof (Ts)), //
+        ...);
+    }(std::index_sequence_for<Ts...> {});
+    return archive;
+  }
+
+  /*! @class ml::movar::variant_archive
+   * @ingroup Serialization
+   * @brief A read-only view of an archive of maybe<Ts...> values, accessed in place.
+   *
+   * Opening an archive only checks its header and the bounds and alignment of its sections, so it
+   * takes constant time whatever the number of rows, and rows are read straight from the archive
+   * bytes, for example from a ml::movar::mapped_file. The bytes must outlive the view.
+   *
+   * Rows are trusted to be consistent with the header: call validate once before reading an archive
+   * from an untrusted source.
+   */
+  template<class... Ts>
+    requires ((internal::movar::Archivable<Ts> && ...) && sizeof...(Ts) > 0 && sizeof...(Ts) < 255)
+  struct variant_archive
+  {
+    using size_type = std::size_t;
+    using row_type = std::uint32_t;
+    using tag_type = std::uint8_t;
+    using const_reference = maybe_ref<Ts const...>;
+
+    static constexpr std::array<std::size_t, sizeof...(Ts) + 1> _sizes {0, sizeof (Ts)...};
+
+    std::span<tag_type const> _tags;
+    row_type const* _slots = nullptr;
+    // The first value of every tag, nullptr for nothing.
+    std::array<std::byte const*, sizeof...(Ts) + 1> _sections {};
+    std::array<std::size_t, sizeof...(Ts) + 1> _counts {};
+
+    /*!
+     * @brief default constructor, an archive without rows
+     */
+    variant_archive () = default;
+
+    /*!
+     * @return a view of the archive in @a bytes, or nothing if its header does not describe an
+     * archive of maybe<Ts...> that fits in @a bytes
+     */
+    [[nodiscard]] static option<variant_archive> open (std::span<std::byte const> bytes) noexcept
+    {
+      internal::movar::archive_header header;
+      std::array<internal::movar::archive_section, sizeof...(Ts)> sections;
+      if (bytes.size () < sizeof (header) + sizeof (sections))
+        return nothing ();
+      std::memcpy (&header, bytes.data (), sizeof (header));
+      std::memcpy (sections.data (), bytes.data () + sizeof (header), sizeof (sections));
+
+      if (header.magic != internal::movar::archive_magic
+        || header.byte_order != internal::movar::archive_byte_order
+        || header.version != internal::movar::archive_version || header.alternatives != sizeof...(Ts)
+        || header.layout != internal::movar::archive_layout<Ts...> ())
+        return nothing ();
+
+      // A section of count values of the given size and alignment must lie inside bytes.
+      auto const fits = [&bytes] (std::uint64_t offset, //
+                          std::uint64_t count,
+                          std::size_t size,
+                          std::size_t align) {
+        return offset <= bytes.size () && count <= (bytes.size () - offset) / size
+          && reinterpret_cast<std::uintptr_t> (bytes.data () + offset) % align == 0;
+      };
+      if (!fits (header.tags, header.rows, 1, 1)
+        || !fits (header.slots, header.rows, sizeof (row_type), alignof (row_type)))
+        return nothing ();
+
+      variant_archive result;
+      result._tags = {reinterpret_cast<tag_type const*> (bytes.data () + header.tags), //
+        static_cast<std::size_t> (header.rows)};
+      result._slots = reinterpret_cast<row_type const*> (bytes.data () + header.slots);
+      bool valid = true;
+      [&]<std::size_t... I> (std::index_sequence<I...>) {
+        ((valid = valid && fits (sections[I].offset, sections[I].count, sizeof (Ts), alignof (Ts)),
+           result._sections[I + 1] = bytes.data () + sections[I].offset,
+           result._counts[I + 1] = sections[I].count),
+          ...);
+      }(std::index_sequence_for<Ts...> {});
+      if (!valid)
+        return nothing ();
+      return result;
+    }
+
+    /*!
+     * @brief Opens the archive in the characters of @a bytes, such as the view of a
+     * ml::movar::mapped_file
+     */
+    [[nodiscard]] static option<variant_archive> open (std::string_view bytes) noexcept
+    {
+      return open (std::as_bytes (std::span (bytes.data (), bytes.size ())));
+    }
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the number of rows
+     */
+    [[nodiscard]] size_type size () const noexcept
+    {
+      return _tags.size ();
+    }
+
+    /*!
+     * @return true if there are no rows
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _tags.empty ();
+    }
+
+    /*!
+     * @return the tag of every row: 0 for nothing, i + 1 for the alternative at index i
+     */
+    [[nodiscard]] std::span<tag_type const> tags () const noexcept
+    {
+      return _tags;
+    }
+
+    /*!
+     * @return the values of the rows holding @a T, in the order of the archived column
+     */
+    template<class T>
+      requires (internal::movar::mp_contains<internal::movar::mp_list<Ts...>, T>::value)
+    [[nodiscard]] std::span<T const> segment () const noexcept
+    {
+      constexpr std::size_t tag = variant_column<Ts...>::template _tag<T>;
+      return {reinterpret_cast<T const*> (_sections[tag]), _counts[tag]};
+    }
+
+    /*!
+     * @return a reference to the value of @a row, inside the archive
+     * @pre @a row < size ()
+     */
+    [[nodiscard]] const_reference operator[] (size_type row) const noexcept
+    {
+      tag_type const tag = _tags[row];
+      return const_reference (static_cast<long> (tag) - 1, _sections[tag] + _slots[row] * _sizes[tag]);
+    }
+
+    /*!
+     * @return the number of rows holding @a T, or of empty rows if @a T is nothing
+     */
+    template<class T>
+      requires (internal::movar::mp_contains<internal::movar::mp_list<nothing, Ts...>, T>::value)
+    [[nodiscard]] size_type count () const noexcept
+    {
+      return internal::movar::count_tag (_tags, variant_column<Ts...>::template _tag<T>);
+    }
+
+    /*!
+     * @return the rows holding @a T, or the empty rows if @a T is nothing, in increasing order
+     */
+    template<class T>
+      requires (internal::movar::mp_contains<internal::movar::mp_list<nothing, Ts...>, T>::value)
+    [[nodiscard]] std::vector<row_type> positions () const
+    {
+      std::vector<row_type> rows;
+      internal::movar::find_tag (_tags, variant_column<Ts...>::template _tag<T>, rows);
+      return rows;
+    }
+
+    /*!
+     * @return true if every row has a valid tag and a position inside its section
+     *
+     * Reads every row once.
+     */
+    [[nodiscard]] bool validate () const noexcept
+    {
+      for (size_type row = 0; row != size (); ++row) {
+        tag_type const tag = _tags[row];
+        if (tag > sizeof...(Ts) || (tag != 0 && _slots[row] >= _counts[tag]))
+          return false;
+      }
+      return true;
+    }
+
+    //! @}
+  };
+
+  /*!
+   * @brief The ml::movar::variant_archive of the alternatives of @a Var
+   * @ingroup Serialization
+   */
+  template<class Var>
+    requires (internal::movar::Variant<Var> && !internal::movar::None<Var>)
+  using variant_archive_for = internal::movar::mp_rename<internal::movar::alternatives<Var>, variant_archive>;
+} // namespace ml::movar
\ No newline at end of file
@@ -0,0 +1,519 @@
+#pragma once
+#include <ml/movar/internal/serialize/bitwise.hpp>
+#include <ml/movar/internal/type/type.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ml::movar
+{
+  /*! @defgroup Serialization Binary serialization
+   */
+
+  struct binary_writer;
+  struct binary_reader;
+} // namespace ml::movar
+
+namespace ml::internal::movar
+{
+  // A type is serialized by the user when serialize (binary_writer&, T const&) is found by argument
+  // dependent lookup, and deserialized by the user when deserialize (binary_reader&, std::type_identity<T>)
+  // is found and returns an option<T>.
+  template<class T>
+  concept UserSerializable = requires (ml::movar::binary_writer& out, T const& value) {
+    serialize (out, value);
+  };
+
+  template<class T>
+  concept UserDeserializable = requires (ml::movar::binary_reader& in) {
+    { deserialize (in, std::type_identity<T> {}) } -> std::same_as<ml::movar::option<T>>;
+  };
+
+  template<class T>
+  struct is_string : std::false_type
+  {};
+
+  template<class C, class Traits, class Allocator>
+  struct is_string<std::basic_string<C, Traits, Allocator>> //
+    : std::bool_constant<std::is_trivially_copyable_v<C>>
+  {};
+
+  // A string view is written like a string, and read back as one.
+  template<class T>
+  struct is_string_view : std::false_type
+  {};
+
+  template<class C, class Traits>
+  struct is_string_view<std::basic_string_view<C, Traits>> //
+    : std::bool_constant<std::is_trivially_copyable_v<C>>
+  {};
+
+  template<class T>
+  struct is_vector : std::false_type
+  {};
+
+  template<class T, class Allocator>
+  struct is_vector<std::vector<T, Allocator>> : std::bool_constant<!std::same_as<T, bool>>
+  {};
+
+  // Values free of pointers are written as their object representation, and arrays of them with a
+  // single copy.
+  template<class T>
+  constexpr inline bool bitwise_serializable = !UserSerializable<T> && !UserDeserializable<T> && !Variant<T>
+    && pointer_free<T>;
+
+  template<class T>
+  constexpr inline bool serializable = [] {
+    if constexpr (UserSerializable<T> || bitwise_serializable<T> || is_string<T>::value
+      || is_string_view<T>::value) {
+      return true;
+    } else if constexpr (is_vector<T>::value) {
+      return serializable<typename T::value_type>;
+    } else if constexpr (Some<T> || Maybe<T>) {
+      return []<class... Ts> (mp_list<Ts...>) {
+        return (serializable<remove_cvref_t<Ts>> && ...);
+      }(alternatives<T> {});
+    } else {
+      return false;
+    }
+  }();
+
+  template<class T>
+  constexpr inline bool deserializable = [] {
+    if constexpr (UserDeserializable<T> || bitwise_serializable<T> || is_string<T>::value) {
+      return true;
+    } else if constexpr (is_vector<T>::value) {
+      return deserializable<typename T::value_type>;
+    } else if constexpr (Some<T> || Maybe<T>) {
+      return []<class... Ts> (mp_list<Ts...>) {
+        return ((std::is_object_v<Ts> && deserializable<std::remove_const_t<Ts>>) && ...);
+      }(alternatives<T> {});
+    } else {
+      return false;
+    }
+  }();
+
+  // The number of values a tag distinguishes: the alternatives, plus nothing for maybe types. A type
+  // with a single state has no tag, up to 256 states take one byte and more take a varint.
+  template<class Var>
+  constexpr std::size_t tag_states = static_cast<std::size_t> (size<Var>) + (Maybe<Var> ? 1 : 0);
+
+  // bool is excluded because reading it validates the byte.
+  template<class T>
+  using is_bitwise_serializable = mp_bool<bitwise_serializable<remove_cvref_t<T>> //
+    && !std::same_as<remove_cvref_t<T>, bool>>;
+
+  // Variants of bitwise alternatives with a tag of at most one byte are written and read with a single
+  // bounds check when at least encoded_size_bound bytes are left.
+  template<class Var>
+  constexpr bool bitwise_alternatives = tag_states<Var> <= 256
+    && mp_all_of<alternatives<Var>, is_bitwise_serializable>::value;
+
+  template<class Var>
+  constexpr std::size_t encoded_size_bound = (tag_states<Var> > 1 ? 1 : 0)
+    + []<class... Ts> (mp_list<Ts...>) { return std::max ({sizeof (Ts)...}); }(alternatives<Var> {});
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  template<class T>
+  concept Serializable = internal::movar::serializable<T>;
+
+  template<class T>
+  concept Deserializable = internal::movar::deserializable<T>;
+
+  /*! @class ml::movar::binary_writer
+   * @ingroup Serialization
+   * @brief Writes values one after the other into a caller provided buffer.
+   *
+   * movar values are written as a tag followed by their active alternative, where the tag is omitted
+   * for types with a single state, takes one byte for up to 256 states and is a varint otherwise.
+   * Arithmetic and enumeration values, arrays of them and classes opted in with ml::movar::enable_bitwise
+   * are copied as they are in memory. Strings, string views and vectors are written as a varint length
+   * followed by their elements, with a single copy for elements copied as they are; a string view is
+   * read back as a string. Other types are written by an overload of
+   * `serialize (binary_writer&, T const&)` found by argument dependent lookup.
+   *
+   * The encoding uses the byte order and object layout of the platform. A write that does not fit
+   * fails the writer: nothing more is written and ok returns false.
+   */
+  struct binary_writer
+  {
+    std::span<std::byte> _buffer;
+    std::size_t _size = 0;
+    bool _failed = false;
+
+    /*!
+     * @brief Writes at the front of @a buffer
+     */
+    explicit binary_writer (std::span<std::byte> buffer) noexcept
+      : _buffer (buffer)
+    {}
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return false if a write did not fit
+     */
+    [[nodiscard]] bool ok () const noexcept
+    {
+      return !_failed;
+    }
+
+    /*!
+     * @return the number of bytes written
+     */
+    [[nodiscard]] std::size_t size () const noexcept
+    {
+      return _size;
+    }
+
+    /*!
+     * @return the bytes written
+     */
+    [[nodiscard]] std::span<std::byte const> written () const noexcept
+    {
+      return _buffer.first (_size);
+    }
+
+    //! @}
+    //! @name Writing
+    //! @{
+
+    /*!
+     * @brief Copies @a count bytes from @a data, or fails the writer if they do not fit
+     */
+    void write_bytes (void const* data, std::size_t count) noexcept
+    {
+      if (_failed || _buffer.size () - _size < count) {
+        _failed = true;
+        return;
+      }
+      if (count != 0)
+        std::memcpy (_buffer.data () + _size, data, count);
+      _size += count;
+    }
+
+    /*!
+     * @brief Writes @a value in 7 bit groups, least significant first
+     */
+    void write_varint (std::uint64_t value) noexcept
+    {
+      std::array<std::byte, 10> bytes;
+      std::size_t count = 0;
+      for (; value >= 0x80; value >>= 7)
+        bytes[count++] = static_cast<std::byte> (value | 0x80);
+      bytes[count++] = static_cast<std::byte> (value);
+      write_bytes (bytes.data (), count);
+    }
+
+    /*!
+     * @brief Writes @a value
+     */
+    template<class T>
+      requires (Serializable<T>)
+    void write (T const& value)
+    {
+      if constexpr (internal::movar::UserSerializable<T>) {
+        serialize (*this, value);
+      } else if constexpr (internal::movar::bitwise_serializable<T>) {
+        write_bytes (std::addressof (value), sizeof (T));
+      } else if constexpr (internal::movar::is_string<T>::value || internal::movar::is_string_view<T>::value
+        || internal::movar::is_vector<T>::value) {
+        _write_sequence (std::span (value.data (), value.size ()));
+      } else {
+        _write_variant (value);
+      }
+    }
+
+    //! @}
+
+    template<class T>
+    void _write_sequence (std::span<T const> elements)
+    {
+      write_varint (elements.size ());
+      if constexpr (internal::movar::bitwise_serializable<T>) {
+        write_bytes (elements.data (), elements.size_bytes ());
+      } else {
+        for (T const& element : elements)
+          write (element);
+      }
+    }
+
+    template<class Var>
+    void _write_variant (Var const& var)
+    {
+      constexpr std::size_t states = internal::movar::tag_states<Var>;
+      auto const tag = static_cast<std::size_t> (var.index () + (internal::movar::Maybe<Var> ? 1 : 0));
+      if constexpr (internal::movar::bitwise_alternatives<Var>)
+        if (!_failed && _buffer.size () - _size >= internal::movar::encoded_size_bound<Var>)
+          return _write_bitwise (var, tag);
+      if constexpr (states > 256)
+        write_varint (tag);
+      else if constexpr (states > 1)
+        write_bytes (std::array {static_cast<std::byte> (tag)}.data (), 1);
+      if constexpr (internal::movar::Maybe<Var>)
+        if (var.is_nothing ())
+          return;
+      boost::mp11::mp_with_index<internal::movar::size<Var>> (var.index (), [this, &var] (auto I) {
+        write (var.template get_unchecked<I> ());
+      });
+    }
+
+    template<class Var>
+    void _write_bitwise (Var const& var, std::size_t tag) noexcept
+    {
+      std::byte* const out = _buffer.data () + _size;
+      constexpr std::size_t header = internal::movar::tag_states<Var> > 1 ? 1 : 0;
+      if constexpr (header == 1)
+        out[0] = static_cast<std::byte> (tag);
+      _size += header;
+      // Dispatching on the tag keeps the empty state on its own branch, where no payload is read.
+      constexpr std::size_t empty = internal::movar::Maybe<Var> ? 1 : 0;
+      _size += boost::mp11::mp_with_index<internal::movar::tag_states<Var>> (tag, [&var, out] (auto S) {
+        if constexpr (S < empty) {
+          return std::size_t (0);
+        } else {
+          auto const& alternative = var.template get_unchecked<S - empty> ();
+          std::memcpy (out + header, std::addressof (alternative), sizeof (alternative));
+          return sizeof (alternative);
+        }
+      });
+    }
+  };
+
+  /*! @class ml::movar::binary_reader
+   * @ingroup Serialization
+   * @brief Reads values written by ml::movar::binary_writer from the front of a buffer.
+   *
+   * Truncated or invalid input fails the reader: the failing read and every later one return
+   * ml::movar::nothing. Types written by a user `serialize` are read by an overload of
+   * `deserialize (binary_reader&, std::type_identity<T>)` returning option<T>, which can call fail on
+   * invalid input.
+   */
+  struct binary_reader
+  {
+    std::span<std::byte const> _buffer;
+    std::size_t _position = 0;
+    bool _failed = false;
+
+    /*!
+     * @brief Reads from the front of @a buffer
+     */
+    explicit binary_reader (std::span<std::byte const> buffer) noexcept
+      : _buffer (buffer)
+    {}
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return false if a read failed
+     */
+    [[nodiscard]] bool ok () const noexcept
+    {
+      return !_failed;
+    }
+
+    /*!
+     * @return the number of bytes read
+     */
+    [[nodiscard]] std::size_t position () const noexcept
+    {
+      return _position;
+    }
+
+    /*!
+     * @return the bytes not read yet
+     */
+    [[nodiscard]] std::span<std::byte const> remaining () const noexcept
+    {
+      return _buffer.subspan (_position);
+    }
+
+    //! @}
+    //! @name Reading
+    //! @{
+
+    /*!
+     * @brief Marks the input as invalid
+     */
+    void fail () noexcept
+    {
+      _failed = true;
+    }
+
+    /*!
+     * @brief Copies the next @a count bytes to @a data
+     * @return false, and fails the reader, if fewer than @a count bytes remain
+     */
+    bool read_bytes (void* data, std::size_t count) noexcept
+    {
+      if (_failed || _buffer.size () - _position < count) {
+        _failed = true;
+        return false;
+      }
+      if (count != 0)
+        std::memcpy (data, _buffer.data () + _position, count);
+      _position += count;
+      return true;
+    }
+
+    /*!
+     * @return the next varint, or nothing if it is truncated or longer than 64 bits
+     */
+    option<std::uint64_t> read_varint () noexcept
+    {
+      std::uint64_t value = 0;
+      for (unsigned shift = 0; shift < 64 && !_failed && _position < _buffer.size (); shift += 7) {
+        auto const byte = std::to_integer<std::uint64_t> (_buffer[_position++]);
+        value |= (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+      _failed = true;
+      return nothing ();
+    }
+
+    /*!
+     * @return the next value of type @a T, or nothing if the input is truncated or invalid
+     */
+    template<class T>
+      requires (Deserializable<T>)
+    option<T> read ()
+    {
+      if (_failed)
+        return nothing ();
+      if constexpr (internal::movar::UserDeserializable<T>) {
+        option<T> result = deserialize (*this, std::type_identity<T> {});
+        if (result.is_nothing ())
+          _failed = true;
+        return result;
+      } else if constexpr (std::same_as<T, bool>) {
+        std::byte byte;
+        if (!read_bytes (&byte, 1))
+          return nothing ();
+        if (std::to_integer<unsigned> (byte) > 1)
+          return _invalid ();
+        return byte == std::byte (1);
+      } else if constexpr (internal::movar::bitwise_serializable<T>) {
+        std::array<std::byte, sizeof (T)> bytes;
+        if (!read_bytes (bytes.data (), sizeof (T)))
+          return nothing ();
+        return std::bit_cast<T> (bytes);
+      } else if constexpr (internal::movar::is_string<T>::value || internal::movar::is_vector<T>::value) {
+        return _read_sequence<T> ();
+      } else {
+        return _read_variant<T> ();
+      }
+    }
+
+    //! @}
+
+    nothing _invalid () noexcept
+    {
+      _failed = true;
+      return nothing ();
+    }
+
+    template<class Sequence>
+    option<Sequence> _read_sequence ()
+    {
+      using element = typename Sequence::value_type;
+      option<std::uint64_t> const length = read_varint ();
+      if (length.is_nothing ())
+        return nothing ();
+      std::size_t const count = static_cast<std::size_t> (length.get ());
+
+      Sequence result;
+      if constexpr (internal::movar::bitwise_serializable<element> && std::default_initializable<element>) {
+        if (count > remaining ().size () / sizeof (element))
+          return _invalid ();
+        result.resize (count);
+        read_bytes (result.data (), count * sizeof (element));
+      } else {
+        result.reserve (std::min (count, remaining ().size ()));
+        for (std::size_t i = 0; i != count; ++i) {
+          option<element> value = read<element> ();
+          if (value.is_nothing ())
+            return nothing ();
+          result.push_back (std::move (value).get ());
+        }
+      }
+      return result;
+    }
+
+    template<class Var>
+    option<Var> _read_variant ()
+    {
+      constexpr std::size_t states = internal::movar::tag_states<Var>;
+      if constexpr (internal::movar::bitwise_alternatives<Var>)
+        if (!_failed && remaining ().size () >= internal::movar::encoded_size_bound<Var>)
+          return _read_bitwise<Var> ();
+      std::size_t tag = 0;
+      if constexpr (states > 256) {
+        option<std::uint64_t> const varint = read_varint ();
+        if (varint.is_nothing ())
+          return nothing ();
+        if (varint.get () >= states)
+          return _invalid ();
+        tag = static_cast<std::size_t> (varint.get ());
+      } else if constexpr (states > 1) {
+        std::byte byte;
+        if (!read_bytes (&byte, 1))
+          return nothing ();
+        tag = std::to_integer<std::size_t> (byte);
+        if (tag >= states)
+          return _invalid ();
+      }
+
+      if constexpr (internal::movar::Maybe<Var>) {
+        if (tag == 0)
+          return Var (nothing ());
+        --tag;
+      }
+      return boost::mp11::mp_with_index<internal::movar::size<Var>> (tag, [this] (auto I) -> option<Var> {
+        using alternative = std::remove_const_t<internal::movar::alternative<Var, I>>;
+        option<alternative> value = read<alternative> ();
+        if (value.is_nothing ())
+          return nothing ();
+        return Var (std::in_place_index<I>, std::move (value).get ());
+      });
+    }
+
+    template<class Var>
+    option<Var> _read_bitwise () noexcept
+    {
+      std::byte const* const in = _buffer.data () + _position;
+      constexpr std::size_t header = internal::movar::tag_states<Var> > 1 ? 1 : 0;
+      std::size_t tag = 0;
+      if constexpr (header == 1) {
+        tag = std::to_integer<std::size_t> (in[0]);
+        if (tag >= internal::movar::tag_states<Var>)
+          return _invalid ();
+      }
+      _position += header;
+      if constexpr (internal::movar::Maybe<Var>) {
+        if (tag == 0)
+          return Var (nothing ());
+        --tag;
+      }
+      return boost::mp11::mp_with_index<internal::movar::size<Var>> (tag, [this, in] (auto I) -> option<Var> {
+        using alternative = std::remove_const_t<internal::movar::alternative<Var, I>>;
+        std::array<std::byte, sizeof (alternative)> bytes;
+        std::memcpy (bytes.data (), in + header, sizeof (alternative));
+        _position += sizeof (alternative);
+        return Var (std::in_place_index<I>, std::bit_cast<alternative> (bytes));
+      });
+    }
+  };
+} // namespace ml::movar
\ No newline at end of file
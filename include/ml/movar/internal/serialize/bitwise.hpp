@@ -0,0 +1,50 @@
+#pragma once
+#include <ml/movar/internal/core/core.hpp>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace ml::movar
+{
+  /*!
+   * @brief Opts the trivially copyable class @a T into being stored as its object representation
+   * @ingroup Serialization
+   *
+   * Specialize it to true for a class that holds no pointer, reference or handle, so that its bytes keep
+   * their meaning when read by another process. Arithmetic and enumeration types, and arrays of them,
+   * need no opt-in.
+   */
+  template<class T>
+  inline constexpr bool enable_bitwise = false;
+} // namespace ml::movar
+
+namespace ml::internal::movar
+{
+  template<class T>
+  struct is_std_array : std::false_type
+  {};
+
+  template<class T, std::size_t N>
+  struct is_std_array<std::array<T, N>> : std::true_type
+  {};
+
+  // Values whose object representation holds no address, so that it can be written by one process and
+  // read by another: arithmetic and enumeration values, arrays of them, and trivially copyable classes
+  // opted in with ml::movar::enable_bitwise. Classes such as std::string_view or std::span are trivially
+  // copyable but point to memory they do not own, so classes are rejected by default.
+  template<class T>
+  constexpr inline bool pointer_free = [] {
+    using unqual = std::remove_cv_t<T>;
+    if constexpr (std::is_arithmetic_v<unqual> || std::is_enum_v<unqual>) {
+      return true;
+    } else if constexpr (std::is_bounded_array_v<unqual>) {
+      return pointer_free<std::remove_extent_t<unqual>>;
+    } else if constexpr (is_std_array<unqual>::value) {
+      return pointer_free<typename unqual::value_type>;
+    } else if constexpr (std::is_class_v<unqual>) {
+      return ml::movar::enable_bitwise<unqual> && std::is_trivially_copyable_v<unqual>;
+    } else {
+      return false;
+    }
+  }();
+} // namespace ml::internal::movar
\ No newline at end of file
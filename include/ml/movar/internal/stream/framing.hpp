@@ -0,0 +1,126 @@
+#pragma once
+#include <ml/movar/internal/type/option.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::delimited
+   * @ingroup Stream
+   * @brief Splits the input into records separated by a delimiter character.
+   *
+   * The delimiter is not part of the record. A trailing delimiter does not produce an empty record.
+   */
+  struct delimited
+  {
+    char _delimiter = '\n';
+
+    constexpr delimited () = default;
+
+    constexpr delimited (char delimiter) noexcept
+      : _delimiter (delimiter)
+    {}
+
+    /*!
+     * @brief Pops the next record from the front of @a input
+     * @return the record, or ml::movar::nothing if @a input is exhausted
+     */
+    [[nodiscard]] constexpr option<std::string_view> next (std::string_view& input) const noexcept
+    {
+      if (input.empty ())
+        return nothing ();
+      std::size_t const end = input.find (_delimiter);
+      if (end == std::string_view::npos)
+        return std::string_view (std::exchange (input, std::string_view ()));
+      std::string_view const record = input.substr (0, end);
+      input.remove_prefix (end + 1);
+      return record;
+    }
+
+    /*!
+     * @brief Returns the offset of the first record that starts at or after @a offset
+     * @param input must start at a record boundary
+     */
+    [[nodiscard]] constexpr std::size_t align (std::string_view input, std::size_t offset) const noexcept
+    {
+      if (offset == 0 || offset >= input.size ())
+        return std::min (offset, input.size ());
+      if (input[offset - 1] == _delimiter)
+        return offset;
+      std::size_t const end = input.find (_delimiter, offset);
+      return end == std::string_view::npos ? input.size () : end + 1;
+    }
+  };
+
+  /*! @class ml::movar::length_prefixed
+   * @ingroup Stream
+   * @brief Splits the input into records preceded by their little-endian byte length.
+   *
+   * A truncated header or payload at the end of the input terminates the stream.
+   */
+  template<std::unsigned_integral Length = std::uint32_t>
+  struct length_prefixed
+  {
+    static constexpr std::size_t header_size = sizeof (Length);
+
+    /*!
+     * @brief Pops the next record from the front of @a input
+     * @return the record, or ml::movar::nothing if @a input is exhausted or truncated
+     */
+    [[nodiscard]] constexpr option<std::string_view> next (std::string_view& input) const noexcept
+    {
+      if (input.size () < header_size) {
+        input = std::string_view ();
+        return nothing ();
+      }
+      Length const length = _decode (input);
+      if (input.size () - header_size < length) {
+        input = std::string_view ();
+        return nothing ();
+      }
+      std::string_view const record = input.substr (header_size, static_cast<std::size_t> (length));
+      input.remove_prefix (header_size + length);
+      return record;
+    }
+
+    /*!
+     * @brief Returns the offset of the first record that starts at or after @a offset
+     * @param input must start at a record boundary
+     * @return the size of @a input if a truncated record is reached first
+     */
+    [[nodiscard]] constexpr std::size_t align (std::string_view input, std::size_t offset) const noexcept
+    {
+      std::size_t position = 0;
+      while (position < offset) {
+        // The remaining bytes must hold the header and the whole payload, which also keeps a hostile
+        // length from wrapping position.
+        std::size_t const remaining = input.size () - position;
+        if (remaining < header_size)
+          return input.size ();
+        Length const length = _decode (input.substr (position));
+        if (remaining - header_size < length)
+          return input.size ();
+        position += header_size + static_cast<std::size_t> (length);
+      }
+      return std::min (position, input.size ());
+    }
+
+    [[nodiscard]] static constexpr Length _decode (std::string_view input) noexcept
+    {
+      Length length = 0;
+      for (std::size_t i = 0; i < header_size; ++i)
+        length |= static_cast<Length> (Length (static_cast<unsigned char> (input[i])) << (8 * i));
+      return length;
+    }
+  };
+
+  template<class T>
+  concept Framing = requires (T const& framing, std::string_view& input, std::size_t offset) {
+    { framing.next (input) } -> std::same_as<option<std::string_view>>;
+    { framing.align (std::string_view (input), offset) } -> std::same_as<std::size_t>;
+  };
+} // namespace ml::movar
@@ -0,0 +1,201 @@
+#pragma once
+#include <ml/movar/internal/type/type.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ml::movar
+{
+  /*! @defgroup Stream Streaming
+   */
+
+  /*! @class ml::movar::mapped_file
+   * @ingroup Stream
+   * @brief A read-only memory mapping of a local file.
+   *
+   * The mapping is private and lives as long as the object. An empty file maps to an empty view.
+   *
+   * The constructor throws std::system_error if the file cannot be opened or mapped, or aborts when
+   * exceptions are disabled. open reports the failure instead.
+   */
+  struct mapped_file
+  {
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+
+    /*!
+     * @brief default constructor, maps nothing
+     */
+    mapped_file () = default;
+
+    /*!
+     * @brief Maps the file at @a path
+     */
+    explicit mapped_file (std::filesystem::path const& path)
+    {
+      std::error_code const error = _map (path);
+      if (error) {
+#if ML_MOVAR_HAS_EXCEPTIONS
+        throw std::system_error (error, path.string ());
+#else
+        std::abort ();
+#endif
+      }
+    }
+
+    /*!
+     * @return the mapping of the file at @a path, or nothing if it cannot be opened or mapped
+     */
+    [[nodiscard]] static option<mapped_file> open (std::filesystem::path const& path) noexcept
+    {
+      std::error_code error;
+      return open (path, error);
+    }
+
+    /*!
+     * @return the mapping of the file at @a path, or nothing if it cannot be opened or mapped, in which
+     * case @a error is set to the reason
+     */
+    [[nodiscard]] static option<mapped_file> open (std::filesystem::path const& path, //
+      std::error_code& error) noexcept
+    {
+      mapped_file file;
+      error = file._map (path);
+      if (error)
+        return nothing ();
+      return file;
+    }
+
+    mapped_file (mapped_file const&) = delete;
+    mapped_file& operator= (mapped_file const&) = delete;
+
+    mapped_file (mapped_file&& other) noexcept
+      : _data (std::exchange (other._data, nullptr))
+      , _size (std::exchange (other._size, 0))
+    {}
+
+    mapped_file& operator= (mapped_file&& other) noexcept
+    {
+      if (this != &other) {
+        _unmap ();
+        _data = std::exchange (other._data, nullptr);
+        _size = std::exchange (other._size, 0);
+      }
+      return *this;
+    }
+
+    ~mapped_file ()
+    {
+      _unmap ();
+    }
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return pointer to the first mapped byte, or nullptr if empty
+     */
+    [[nodiscard]] char const* data () const noexcept
+    {
+      return _data;
+    }
+
+    /*!
+     * @return the size of the mapping in bytes
+     */
+    [[nodiscard]] std::size_t size () const noexcept
+    {
+      return _size;
+    }
+
+    /*!
+     * @return true if nothing is mapped
+     */
+    [[nodiscard]] bool empty () const noexcept
+    {
+      return _size == 0;
+    }
+
+    /*!
+     * @return the whole mapping as a string view
+     */
+    [[nodiscard]] std::string_view view () const noexcept
+    {
+      return std::string_view (_data, _size);
+    }
+
+    //! @}
+    //! @name Paging hints
+    //! @{
+
+    /*!
+     * @brief Hints that the mapping will be read front to back
+     */
+    void advise_sequential () const noexcept
+    {
+      if (_size > 0)
+        ::madvise (const_cast<char*> (_data), _size, MADV_SEQUENTIAL);
+    }
+
+    /*!
+     * @brief Asks the kernel to page in [offset, offset + length)
+     */
+    void prefetch (std::size_t offset, std::size_t length) const noexcept
+    {
+      if (offset >= _size || length == 0)
+        return;
+      std::size_t const page = static_cast<std::size_t> (::sysconf (_SC_PAGESIZE));
+      std::size_t const begin = offset - offset % page;
+      std::size_t const end = std::min (offset + length, _size);
+      ::madvise (const_cast<char*> (_data) + begin, end - begin, MADV_WILLNEED);
+    }
+
+    //! @}
+
+    std::error_code _map (std::filesystem::path const& path) noexcept
+    {
+      int const fd = ::open (path.c_str (), O_RDONLY | O_CLOEXEC);
+      if (fd < 0)
+        return std::error_code (errno, std::generic_category ());
+
+      struct ::stat info;
+      if (::fstat (fd, &info) < 0) {
+        int const error = errno;
+        ::close (fd);
+        return std::error_code (error, std::generic_category ());
+      }
+
+      std::size_t const size = static_cast<std::size_t> (info.st_size);
+      if (size > 0) {
+        void* const address = ::mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+          int const error = errno;
+          ::close (fd);
+          return std::error_code (error, std::generic_category ());
+        }
+        _data = static_cast<char const*> (address);
+      }
+      _size = size;
+      ::close (fd);
+      return {};
+    }
+
+    void _unmap () noexcept
+    {
+      if (_data != nullptr)
+        ::munmap (const_cast<char*> (_data), _size);
+      _data = nullptr;
+      _size = 0;
+    }
+  };
+} // namespace ml::movar
\ No newline at end of file
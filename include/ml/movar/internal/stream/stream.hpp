@@ -0,0 +1,264 @@
+#pragma once
+#include <ml/movar/internal/stream/framing.hpp>
+#include <ml/movar/internal/stream/mapped_file.hpp>
+#include <atomic>
+#include <exception>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::stream_options
+   * @ingroup Stream
+   * @brief Tuning knobs for ml::movar::stream
+   */
+  struct stream_options
+  {
+    //! approximate number of bytes handed to a worker at once
+    std::size_t chunk_size = std::size_t (1) << 20;
+
+    //! number of worker threads, 1 processes records on the calling thread
+    unsigned threads = 1;
+
+    //! issue madvise hints ahead of the chunk being processed
+    bool prefetch = true;
+  };
+
+  /*! @class ml::movar::stream_stats
+   * @ingroup Stream
+   * @brief Counters returned by ml::movar::stream
+   */
+  struct stream_stats
+  {
+    //! records extracted from the input
+    std::size_t records = 0;
+
+    //! pipeline results that were not ml::movar::nothing
+    std::size_t results = 0;
+
+    bool operator== (stream_stats const&) const = default;
+  };
+
+  /*! @class ml::movar::ostream_sink
+   * @ingroup Stream
+   * @brief A sink that writes every value followed by a delimiter to a std::ostream
+   */
+  struct ostream_sink
+  {
+    std::ostream* _out;
+    char _delimiter = '\n';
+
+    ostream_sink (std::ostream& out, char delimiter = '\n') noexcept
+      : _out (&out)
+      , _delimiter (delimiter)
+    {}
+
+    template<class T>
+    void operator() (T const& value) const
+    {
+      *_out << value << _delimiter;
+    }
+  };
+} // namespace ml::movar
+
+namespace ml::internal::movar
+{
+  template<class Pipeline>
+  using stream_result = wrap_invoke_result<Pipeline const&, std::string_view>;
+
+  template<class Result, class Sink>
+  static constexpr bool _emit (Result&& result, Sink& sink)
+  {
+    if constexpr (None<remove_cvref_t<Result>>) {
+      return false;
+    } else {
+      if constexpr (Maybe<remove_cvref_t<Result>>)
+        if (result.is_nothing ())
+          return false;
+      impl::weak_visit (sink, std::forward<Result> (result));
+      return true;
+    }
+  }
+
+  template<class Framer, class Pipeline, class Out>
+  static std::size_t _stream_chunk (std::string_view chunk, //
+    Framer const& framing,
+    Pipeline const& pipeline,
+    Out&& out)
+  {
+    std::size_t records = 0;
+    for (auto record = framing.next (chunk); record.is_something (); record = framing.next (chunk)) {
+      ++records;
+      out (impl::wrap_invoke (pipeline, record.get ()));
+    }
+    return records;
+  }
+
+  template<class Framer>
+  static std::vector<std::size_t> _stream_boundaries (std::string_view input,
+    Framer const& framing,
+    std::size_t chunk_size)
+  {
+    std::vector<std::size_t> boundaries {0};
+    chunk_size = std::max<std::size_t> (chunk_size, 1);
+    while (boundaries.back () < input.size ()) {
+      std::size_t const begin = boundaries.back ();
+      boundaries.push_back (begin + framing.align (input.substr (begin), chunk_size));
+    }
+    return boundaries;
+  }
+
+  template<class Framer, class Pipeline, class Sink>
+  static ml::movar::stream_stats _stream_sequential (ml::movar::mapped_file const& file,
+    Framer const& framing,
+    Pipeline const& pipeline,
+    Sink& sink,
+    ml::movar::stream_options const& options)
+  {
+    ml::movar::stream_stats stats;
+    auto const out = [&] (auto&& result) {
+      stats.results += _emit (std::forward<decltype (result)> (result), sink);
+    };
+
+    if (!options.prefetch) {
+      stats.records = _stream_chunk (file.view (), framing, pipeline, out);
+      return stats;
+    }
+
+    std::string_view const input = file.view ();
+    std::size_t const chunk_size = std::max<std::size_t> (options.chunk_size, 1);
+    for (std::size_t begin = 0; begin < input.size ();) {
+      std::size_t const end = begin + framing.align (input.substr (begin), chunk_size);
+      file.prefetch (end, chunk_size);
+      stats.records += _stream_chunk (input.substr (begin, end - begin), framing, pipeline, out);
+      begin = end;
+    }
+    return stats;
+  }
+
+  template<class Framer, class Pipeline, class Sink>
+  static ml::movar::stream_stats _stream_parallel (ml::movar::mapped_file const& file,
+    Framer const& framing,
+    Pipeline const& pipeline,
+    Sink& sink,
+    ml::movar::stream_options const& options)
+  {
+    using result_type = stream_result<Pipeline>;
+
+    struct chunk_output
+    {
+      std::vector<result_type> results;
+      std::size_t records = 0;
+      std::exception_ptr error;
+    };
+
+    std::string_view const input = file.view ();
+    std::vector<std::size_t> const boundaries = _stream_boundaries (input, framing, options.chunk_size);
+    std::size_t const chunks = boundaries.size () - 1;
+    std::size_t const window = std::size_t (options.threads) * 4;
+
+    ml::movar::stream_stats stats;
+    std::vector<chunk_output> outputs (window);
+
+    // Chunks are processed in windows so that memory stays bounded and results reach the sink in order.
+    for (std::size_t first = 0; first < chunks; first += window) {
+      std::size_t const last = std::min (first + window, chunks);
+      std::atomic<std::size_t> next = first;
+
+      auto const worker = [&] {
+        for (std::size_t i = next++; i < last; i = next++) {
+          chunk_output& output = outputs[i - first];
+          std::size_t const begin = boundaries[i];
+          std::size_t const end = boundaries[i + 1];
+          auto const process = [&] {
+            if (options.prefetch)
+              file.prefetch (begin, end - begin);
+            output.records = _stream_chunk (input.substr (begin, end - begin), framing, pipeline, //
+              [&] (result_type&& result) {
+                if constexpr (!None<result_type>)
+                  if (result.is_something ())
+                    output.results.push_back (std::move (result));
+              });
+          };
+#if ML_MOVAR_HAS_EXCEPTIONS
+          try {
+            process ();
+          } catch (...) {
+            output.error = std::current_exception ();
+          }
+#else
+          process ();
+#endif
+        }
+      };
+
+      std::vector<std::thread> threads;
+      threads.reserve (options.threads - 1);
+      for (unsigned t = 1; t < options.threads; ++t)
+        threads.emplace_back (worker);
+      worker ();
+      for (std::thread& thread : threads)
+        thread.join ();
+
+      for (std::size_t i = first; i < last; ++i) {
+        chunk_output& output = outputs[i - first];
+#if ML_MOVAR_HAS_EXCEPTIONS
+        if (output.error)
+          std::rethrow_exception (output.error);
+#endif
+        stats.records += output.records;
+        for (result_type& result : output.results)
+          stats.results += _emit (std::move (result), sink);
+        output.results.clear ();
+        output.records = 0;
+      }
+    }
+    return stats;
+  }
+} // namespace ml::internal::movar
+
+namespace ml::movar
+{
+  /*!
+   * @ingroup Stream
+   * @brief Runs every record of a memory-mapped file through a pipeline
+   *
+   * The input is split into records by @a framing. Each record is handed to @a pipeline as a
+   * std::string_view pointing into the mapping, and the active alternative of every result that is not
+   * ml::movar::nothing is passed to @a sink.
+   *
+   * With `options.threads > 1` the file is cut into chunks at record boundaries and the pipeline is invoked
+   * concurrently, so it must be safe to call from several threads. The sink is always invoked from the
+   * calling thread, in input order.
+   */
+  template<Framing Framer, class Pipeline, class Sink>
+    requires (internal::movar::WrapInvocable<Pipeline const&, std::string_view>)
+  stream_stats stream (mapped_file const& file,
+    Framer const& framing,
+    Pipeline const& pipeline,
+    Sink&& sink,
+    stream_options const& options = {})
+  {
+    if (options.prefetch)
+      file.advise_sequential ();
+    if (options.threads <= 1)
+      return internal::movar::_stream_sequential (file, framing, pipeline, sink, options);
+    return internal::movar::_stream_parallel (file, framing, pipeline, sink, options);
+  }
+
+  /*!
+   * @ingroup Stream
+   * @brief Maps the file at @a path and streams it, see the overload taking a ml::movar::mapped_file
+   */
+  template<Framing Framer, class Pipeline, class Sink>
+    requires (internal::movar::WrapInvocable<Pipeline const&, std::string_view>)
+  stream_stats stream (std::filesystem::path const& path,
+    Framer const& framing,
+    Pipeline const& pipeline,
+    Sink&& sink,
+    stream_options const& options = {})
+  {
+    return ml::movar::stream (mapped_file (path), framing, pipeline, std::forward<Sink> (sink), options);
+  }
+} // namespace ml::movar
@@ -49,11 +49,32 @@ namespace ml::movar
       : _value (std::move (value))
     {}
 
+    /*!
+     * @brief Constructs the alternative at @a Index in place from @a args
+     */
+    template<std::size_t Index, class... Args>
+      requires (Index < 2 && std::constructible_from<internal::movar::alternative<either, Index>, Args...>)
+    constexpr explicit either (std::in_place_index_t<Index>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<internal::movar::alternative<either, Index>, Args...>)
+      : _value (std::in_place_index<Index>, std::forward<Args> (args)...)
+    {}
+
+    /*!
+     * @brief Constructs the alternative @a T in place from @a args
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<either, T> && std::constructible_from<T, Args...>)
+    constexpr explicit either (std::in_place_type_t<T>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<T, Args...>)
+      : either (std::in_place_index<internal::movar::alternative_index<either, T>>, //
+        std::forward<Args> (args)...)
+    {}
+
     template<internal::movar::DiffUnqual<either> Other>
       requires (internal::movar::can_explicit_cast<Other, either>)
-    explicit(!internal::movar::can_implicit_cast<Other, either>) constexpr either (Other other) //
-      noexcept (noexcept (either (internal::movar::impl::cast<either> (std::move (other)))))    //
-      : either (internal::movar::impl::cast<either> (std::move (other)))
+    explicit(!internal::movar::can_implicit_cast<Other, either>) constexpr either (Other&& other)      //
+      noexcept (noexcept (either (internal::movar::impl::cast<either> (std::forward<Other> (other))))) //
+      : either (internal::movar::impl::cast<either> (std::forward<Other> (other)))
     {}
 
     //! @name Observers
@@ -122,71 +143,236 @@ namespace ml::movar
     /*!
      * @brief get with index (overload 1)
      * @tparam Index can be 0 or 1
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<either, Index>)
-    [[nodiscard]] constexpr auto const& get () const& noexcept
+    [[nodiscard]] constexpr auto const& get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<Index> (&_value);
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief get with index (overload 2)
      * @tparam Index can be 0 or 1
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<either, Index>)
-    [[nodiscard]] constexpr auto& get () & noexcept
+    [[nodiscard]] constexpr auto& get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<Index> (&_value);
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief get with index (overload 3)
      * @tparam Index can be 0 or 1
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     * @note the result refers to the either, see extract to move the value out of a temporary
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<either, Index>)
-    [[nodiscard]] constexpr auto get () &&                                                           //
-      noexcept (std::is_nothrow_move_constructible_v<T1>&& std::is_nothrow_move_constructible_v<T2>) //
+    [[nodiscard]] constexpr auto&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return std::move (*std::get_if<Index> (&_value));
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<Index> ();
     }
 
     /*!
      * @brief get with type (overload 1)
      * @tparam T can be @a T1 or @a T2
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<either, T>)
-    [[nodiscard]] constexpr T const& get () const& noexcept
+    [[nodiscard]] constexpr T const& get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<T> (&_value);
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief get with type (overload 2)
      * @tparam T can be @a T1 or @a T2
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<either, T>)
-    [[nodiscard]] constexpr T& get () & noexcept
+    [[nodiscard]] constexpr T& get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<T> (&_value);
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief get with type (overload 3)
      * @tparam T can be @a T1 or @a T2
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     * @note the result refers to the either, see extract to move the value out of a temporary
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<either, T>)
+    [[nodiscard]] constexpr T&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<T> ();
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 1)
+     * @tparam Index can be 0 or 1
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<either, Index>)
+    [[nodiscard]] constexpr auto const& get_unchecked () const& noexcept
+    {
+      return *std::get_if<Index> (&_value);
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 2)
+     * @tparam Index can be 0 or 1
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<either, Index>)
+    [[nodiscard]] constexpr auto& get_unchecked () & noexcept
+    {
+      return *std::get_if<Index> (&_value);
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 3)
+     * @tparam Index can be 0 or 1
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<either, Index>)
+    [[nodiscard]] constexpr auto&& get_unchecked () && noexcept
+    {
+      return std::move (*std::get_if<Index> (&_value));
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 1)
+     * @tparam T can be @a T1 or @a T2
+     * @pre @a T is the active alternative
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<either, T>)
-    [[nodiscard]] constexpr T get () &&                                                              //
-      noexcept (std::is_nothrow_move_constructible_v<T1>&& std::is_nothrow_move_constructible_v<T2>) //
+    [[nodiscard]] constexpr T const& get_unchecked () const& noexcept
+    {
+      return *std::get_if<T> (&_value);
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 2)
+     * @tparam T can be @a T1 or @a T2
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<either, T>)
+    [[nodiscard]] constexpr T& get_unchecked () & noexcept
+    {
+      return *std::get_if<T> (&_value);
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 3)
+     * @tparam T can be @a T1 or @a T2
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<either, T>)
+    [[nodiscard]] constexpr T&& get_unchecked () && noexcept
     {
       return std::move (*std::get_if<T> (&_value));
     }
 
+    /*!
+     * @brief Moves the alternative at @a Index out of the either
+     * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     *
+     * Unlike the rvalue getters, the result is a value that does not refer to the either, so it is safe to
+     * bind it to a reference that outlives a temporary either.
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<either, Index>)
+    [[nodiscard]] constexpr auto extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS
+        && std::is_nothrow_move_constructible_v<internal::movar::alternative<either, Index>>)
+    {
+      return std::move (*this).template get<Index> ();
+    }
+
+    /*!
+     * @brief Moves the alternative @a T out of the either
+     * @tparam T must be an alternative
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<either, T>)
+    [[nodiscard]] constexpr T extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS && std::is_nothrow_move_constructible_v<T>)
+    {
+      return std::move (*this).template get<T> ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Destroys the active alternative and constructs the alternative at @a Index from @a args
+     * @return the new alternative
+     *
+     * The alternative is constructed in place when that cannot throw, otherwise it is constructed aside
+     * and moved in, so that a throwing constructor leaves the either unchanged.
+     */
+    template<long Index, class... Args>
+      requires (internal::movar::ContainsIndex<either, Index>
+        && std::constructible_from<internal::movar::alternative<either, Index>, Args...>
+        && (std::is_nothrow_constructible_v<internal::movar::alternative<either, Index>, Args...>
+          || std::is_nothrow_move_constructible_v<internal::movar::alternative<either, Index>>))
+    constexpr auto& emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<internal::movar::alternative<either, Index>, Args...>)
+    {
+      using type = internal::movar::alternative<either, Index>;
+      if constexpr (std::is_nothrow_constructible_v<type, Args...>)
+        return _value.template emplace<Index> (std::forward<Args> (args)...);
+      else
+        return _value.template emplace<Index> (type (std::forward<Args> (args)...));
+    }
+
+    /*!
+     * @brief Destroys the active alternative and constructs the alternative @a T from @a args
+     * @return the new alternative
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<either, T> && std::constructible_from<T, Args...>
+        && (std::is_nothrow_constructible_v<T, Args...> || std::is_nothrow_move_constructible_v<T>))
+    constexpr T& emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<T, Args...>)
+    {
+      return emplace<internal::movar::alternative_index<either, T>> (std::forward<Args> (args)...);
+    }
+
     //! @}
     //! @name Friends
     //! @{
@@ -261,6 +447,24 @@ namespace ml::movar
       return internal::movar::impl::map (std::move (*this), std::move (vis));
     }
 
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const&
+    {
+      return deferred_map<either const&, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) &&
+    {
+      return deferred_map<either, Vis> {std::move (*this), std::move (vis)};
+    }
+
     /*!
      * @brief see [pipelines documentation](#pipelines-match)
      */
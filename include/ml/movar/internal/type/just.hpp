@@ -1,5 +1,7 @@
 #pragma once
 #include <ml/movar/internal/core/core.hpp>
+#include <memory>
+#include <utility>
 
 namespace ml::movar
 {
@@ -39,11 +41,31 @@ namespace ml::movar
       : _value (std::move (value))
     {}
 
+    /*!
+     * @brief Constructs ValueType in place from @a args
+     */
+    template<class... Args>
+      requires (std::constructible_from<ValueType, Args...>)
+    constexpr explicit just (std::in_place_index_t<0>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+      : _value (std::forward<Args> (args)...)
+    {}
+
+    /*!
+     * @brief Constructs ValueType in place from @a args
+     */
+    template<class... Args>
+      requires (std::constructible_from<ValueType, Args...>)
+    constexpr explicit just (std::in_place_type_t<ValueType>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+      : just (std::in_place_index<0>, std::forward<Args> (args)...)
+    {}
+
     template<internal::movar::DiffUnqual<just> Other>
       requires (internal::movar::can_explicit_cast<Other, just>)
-    explicit(!internal::movar::can_implicit_cast<Other, just>) constexpr just (Other other) //
-      noexcept (noexcept (just (internal::movar::impl::cast<just> (std::move (other)))))    //
-      : just (internal::movar::impl::cast<just> (std::move (other)))
+    explicit(!internal::movar::can_implicit_cast<Other, just>) constexpr just (Other&& other)      //
+      noexcept (noexcept (just (internal::movar::impl::cast<just> (std::forward<Other> (other))))) //
+      : just (internal::movar::impl::cast<just> (std::forward<Other> (other)))
     {}
 
     /*!
@@ -149,11 +171,11 @@ namespace ml::movar
     /*!
      * @brief get with index (overload 3)
      * @tparam Index must be 0
+     * @note the result refers to the just, see extract to move the value out of a temporary
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<just, Index>)
-    [[nodiscard]] constexpr value_type get () && //
-      noexcept (std::is_nothrow_move_constructible_v<value_type>)
+    [[nodiscard]] constexpr value_type&& get () && noexcept
     {
       return std::move (_value);
     }
@@ -183,15 +205,155 @@ namespace ml::movar
     /*!
      * @brief get with type (overload 3)
      * @tparam T must be ValueType
+     * @note the result refers to the just, see extract to move the value out of a temporary
      */
     template<class T = value_type>
       requires (ml::internal::movar::ContainsAlternative<just, T>)
-    [[nodiscard]] constexpr value_type get () && //
-      noexcept (std::is_nothrow_move_constructible_v<value_type>)
+    [[nodiscard]] constexpr value_type&& get () && noexcept
+    {
+      return std::move (_value);
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 1)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<just, Index>)
+    [[nodiscard]] constexpr const_reference get_unchecked () const& noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 2)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<just, Index>)
+    [[nodiscard]] constexpr reference get_unchecked () & noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @brief unchecked get with index (overload 3)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<just, Index>)
+    [[nodiscard]] constexpr value_type&& get_unchecked () && noexcept
+    {
+      return std::move (_value);
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 1)
+     * @tparam T must be ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (ml::internal::movar::ContainsAlternative<just, T>)
+    [[nodiscard]] constexpr const_reference get_unchecked () const& noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 2)
+     * @tparam T must be ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (ml::internal::movar::ContainsAlternative<just, T>)
+    [[nodiscard]] constexpr reference get_unchecked () & noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @brief unchecked get with type (overload 3)
+     * @tparam T must be ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (ml::internal::movar::ContainsAlternative<just, T>)
+    [[nodiscard]] constexpr value_type&& get_unchecked () && noexcept
     {
       return std::move (_value);
     }
 
+    /*!
+     * @brief Moves the value out of the just
+     * @tparam Index must be 0
+     *
+     * Unlike the rvalue getters, the result is a value that does not refer to the just, so it is safe to
+     * bind it to a reference that outlives a temporary just.
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<just, Index>)
+    [[nodiscard]] constexpr value_type extract () && //
+      noexcept (std::is_nothrow_move_constructible_v<value_type>)
+    {
+      return std::move (*this).template get<Index> ();
+    }
+
+    /*!
+     * @brief Moves the value out of the just
+     * @tparam T must be ValueType
+     */
+    template<class T = value_type>
+      requires (internal::movar::ContainsAlternative<just, T>)
+    [[nodiscard]] constexpr value_type extract () && //
+      noexcept (std::is_nothrow_move_constructible_v<value_type>)
+    {
+      return std::move (*this).template get<T> ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Replaces the value with one constructed from @a args
+     * @tparam Index must be 0
+     * @return the new value
+     *
+     * The value is constructed in place when that cannot throw, otherwise it is constructed aside and
+     * move-assigned so that the just always holds a value.
+     */
+    template<long Index, class... Args>
+      requires (internal::movar::ContainsIndex<just, Index> && std::constructible_from<ValueType, Args...>
+        && (std::is_nothrow_constructible_v<ValueType, Args...> || std::is_move_assignable_v<ValueType>))
+    constexpr reference emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+    {
+      if constexpr (std::is_nothrow_constructible_v<ValueType, Args...>) {
+        std::destroy_at (std::addressof (_value));
+        return *std::construct_at (std::addressof (_value), std::forward<Args> (args)...);
+      } else {
+        _value = ValueType (std::forward<Args> (args)...);
+        return _value;
+      }
+    }
+
+    /*!
+     * @brief Replaces the value with one constructed from @a args
+     * @tparam T must be ValueType
+     * @return the new value
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<just, T> && std::constructible_from<ValueType, Args...>
+        && (std::is_nothrow_constructible_v<ValueType, Args...> || std::is_move_assignable_v<ValueType>))
+    constexpr reference emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+    {
+      return emplace<0> (std::forward<Args> (args)...);
+    }
+
     //! @}
     //! @name Friends
     //! @{
@@ -266,6 +428,24 @@ namespace ml::movar
       return internal::movar::impl::map (std::move (*this), std::move (vis));
     }
 
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const&
+    {
+      return deferred_map<just const&, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) &&
+    {
+      return deferred_map<just, Vis> {std::move (*this), std::move (vis)};
+    }
+
     /*!
      * @brief see [pipelines documentation](#pipelines-match)
      */
@@ -0,0 +1,330 @@
+#pragma once
+#include <ml/movar/internal/type/nothing.hpp>
+#include <memory>
+#include <variant>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::maybe_ref
+   * @brief A non-owning view of an object that is one of many alternatives, or of nothing.
+   * @ingroup Variant
+   *
+   * The view counterpart of ml::movar::maybe, see ml::movar::maybe_ref.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct maybe_ref
+  {
+    static_assert ((!std::is_volatile_v<Ts> && ...));
+    static_assert ((std::is_object_v<Ts> && ...));
+
+    //! Untyped pointer to a payload, const if every alternative is const
+    using erased_pointer = std::conditional_t<(std::is_const_v<Ts> && ...), void const*, void*>;
+
+    std::variant<nothing, Ts*...> _value {};
+
+    /*!
+     * @brief default constructor, refers to nothing
+     */
+    maybe_ref () = default;
+
+    /*!
+     * @brief Refers to nothing
+     */
+    constexpr maybe_ref (nothing) noexcept
+      : _value ()
+    {}
+
+    /*!
+     * @brief Refers to nothing
+     */
+    constexpr maybe_ref (std::nullopt_t) noexcept
+      : _value ()
+    {}
+
+    /*!
+     * @brief Refers to @a ref
+     */
+    template<class T>
+      requires (internal::movar::ContainsReferenceTo<maybe_ref, T>)
+    constexpr maybe_ref (T& ref) noexcept
+      : _value (std::in_place_index<internal::movar::reference_index<maybe_ref, T> + 1>, //
+          std::addressof (ref))
+    {}
+
+    /*!
+     * @brief Refers to @a ref as the alternative at @a Index
+     */
+    template<std::size_t Index>
+      requires (Index < sizeof...(Ts))
+    constexpr maybe_ref (std::in_place_index_t<Index>, //
+      internal::movar::alternative<maybe_ref, Index> ref) noexcept
+      : _value (std::in_place_index<Index + 1>, std::addressof (ref))
+    {}
+
+    /*!
+     * @brief Refers to @a payload as the alternative at @a index, or to nothing if @a index is -1
+     * @pre @a index is in [-1, size) and @a payload points to an object of that alternative
+     */
+    maybe_ref (long index, erased_pointer payload) noexcept
+    {
+      // The pointer is emplaced in place: returning the empty state by value would copy its uninitialized
+      // storage.
+      if (index < 0)
+        return;
+      boost::mp11::mp_with_index<sizeof...(Ts)> (static_cast<std::size_t> (index), [this, payload] (auto I) {
+        using pointer = std::remove_reference_t<internal::movar::alternative<maybe_ref, I>>*;
+        _value.template emplace<I + 1> (static_cast<pointer> (payload));
+      });
+    }
+
+    /*!
+     * @brief Refers to the active alternative of @a owner, or to nothing if @a owner is empty
+     */
+    template<class Owner>
+      requires (internal::movar::can_view<maybe_ref, Owner>)
+    constexpr maybe_ref (Owner& owner) noexcept
+      : _value (boost::mp11::mp_with_index<sizeof...(Ts) + 1> (owner.index () + 1, [&owner] (auto I) {
+        if constexpr (I == 0) {
+          return std::variant<nothing, Ts*...> ();
+        } else {
+          auto& alternative = owner.template get_unchecked<I - 1> ();
+          return std::variant<nothing, Ts*...> (std::in_place_index<I>, std::addressof (alternative));
+        }
+      }))
+    {}
+
+    /*!
+     * @brief Refers to the object referred to by @a other
+     */
+    constexpr maybe_ref (variant_ref<Ts...> other) noexcept
+      : _value (boost::mp11::mp_with_index<sizeof...(Ts)> (other.index (), [&other] (auto I) {
+        auto& alternative = other.template get_unchecked<I> ();
+        return std::variant<nothing, Ts*...> (std::in_place_index<I + 1>, std::addressof (alternative));
+      }))
+    {}
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the active index
+     */
+    [[nodiscard]] constexpr long index () const noexcept
+    {
+      return static_cast<long> (_value.index ()) - 1;
+    }
+
+    /*!
+     * @return true if the view refers to nothing
+     */
+    [[nodiscard]] constexpr bool is_nothing () const noexcept
+    {
+      return _value.index () == 0;
+    }
+
+    /*!
+     * @return false if the view refers to nothing
+     */
+    [[nodiscard]] constexpr bool is_something () const noexcept
+    {
+      return _value.index () != 0;
+    }
+
+    /*!
+     * @return true if @a Index equals the active index
+     * @tparam Index must be in [-1, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<maybe_ref, Index> || Index == -1)
+    [[nodiscard]] constexpr bool is () const noexcept
+    {
+      return index () == Index;
+    }
+
+    /*!
+     * @return true if the view refers to an object of type @a T
+     * @tparam T must be a referenced type or ml::movar::nothing
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<maybe_ref, T&> || std::same_as<T, nothing>)
+    [[nodiscard]] constexpr bool is () const noexcept
+    {
+      if constexpr (std::same_as<T, nothing>) {
+        return is_nothing ();
+      } else {
+        return std::holds_alternative<T*> (_value);
+      }
+    }
+
+    //! @}
+    //! @name Getters
+    //! @{
+
+    /*!
+     * @brief getter given index
+     * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<maybe_ref, Index>)
+    [[nodiscard]] constexpr auto& get () const noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
+    }
+
+    /*!
+     * @brief getter given type
+     * @tparam T must be a referenced type
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<maybe_ref, T&>)
+    [[nodiscard]] constexpr T& get () const noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
+    }
+
+    /*!
+     * @brief unchecked getter given index
+     * @tparam Index must be in [0, size)
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<maybe_ref, Index>)
+    [[nodiscard]] constexpr auto& get_unchecked () const noexcept
+    {
+      return **std::get_if<Index + 1> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given type
+     * @tparam T must be a referenced type
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<maybe_ref, T&>)
+    [[nodiscard]] constexpr T& get_unchecked () const noexcept
+    {
+      return **std::get_if<T*> (&_value);
+    }
+
+    //! @}
+    //! @name Friends
+    //! @{
+
+    /*!
+     * @return true if @a Index equals the active index
+     * @tparam Index must be in [-1, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<maybe_ref, Index> || Index == -1)
+    [[nodiscard]] friend constexpr bool is (maybe_ref const& self) noexcept
+    {
+      return self.template is<Index> ();
+    }
+
+    /*!
+     * @return true if the view refers to an object of type @a T
+     * @tparam T must be a referenced type or ml::movar::nothing
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<maybe_ref, T&> || std::same_as<T, nothing>)
+    [[nodiscard]] friend constexpr bool is (maybe_ref const& self) noexcept
+    {
+      return self.template is<T> ();
+    }
+
+    /*!
+     * @brief getter given index
+     * @tparam Index must be in [0, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<maybe_ref, Index>)
+    [[nodiscard]] friend constexpr auto& get (maybe_ref const& self) noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      return self.template get<Index> ();
+    }
+
+    /*!
+     * @brief getter given type
+     * @tparam T must be a referenced type
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<maybe_ref, T&>)
+    [[nodiscard]] friend constexpr T& get (maybe_ref const& self) noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      return self.template get<T> ();
+    }
+
+    //! @}
+    //! @name Pipeline
+    //! @{
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map  )
+     */
+    template<internal::movar::WeakVisitor<maybe_ref const&> Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) const
+    {
+      return internal::movar::impl::map (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const
+    {
+      return deferred_map<maybe_ref, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-match)
+     */
+    template<internal::movar::Visitor<maybe_ref const&> Vis>
+    constexpr auto match (Vis vis) const
+    {
+      return internal::movar::impl::match (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map_or)
+     */
+    template<internal::movar::WeakVisitor<maybe_ref const&> Vis, std::move_constructible Default>
+    [[nodiscard]] constexpr auto map_or (Vis vis, Default def) const
+    {
+      return internal::movar::impl::map_or (*this, std::move (vis), std::move (def));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map_or_else)
+     */
+    template<internal::movar::WeakVisitor<maybe_ref const&> Vis, internal::movar::Lazy Default>
+    [[nodiscard]] constexpr auto map_or_else (Vis vis, Default def) const
+    {
+      return internal::movar::impl::map_or_else (*this, std::move (vis), std::move (def));
+    }
+
+    //! @}
+  };
+
+  template<class... Ts>
+  maybe_ref (maybe<Ts...>&) -> maybe_ref<Ts...>;
+
+  template<class... Ts>
+  maybe_ref (maybe<Ts...> const&) -> maybe_ref<Ts const...>;
+
+  template<class T>
+  maybe_ref (option<T>&) -> maybe_ref<T>;
+
+  template<class T>
+  maybe_ref (option<T> const&) -> maybe_ref<T const>;
+
+  template<class... Ts>
+  maybe_ref (variant_ref<Ts...>) -> maybe_ref<Ts...>;
+} // namespace ml::movar
\ No newline at end of file
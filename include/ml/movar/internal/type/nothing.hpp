@@ -136,7 +136,7 @@ namespace ml::movar
      * @brief see [pipelines documentation](#pipelines-map_or)
      */
     template<std::move_constructible Vis, std::move_constructible Default>
-    [[nodiscard]] constexpr auto map_or (Vis vis, Default def) const
+    [[nodiscard]] constexpr auto map_or (Vis, Default def) const
     {
       return def;
     }
@@ -34,6 +34,26 @@ namespace ml::movar
       : _value (std::move (value))
     {}
 
+    /*!
+     * @brief Constructs ValueType in place from @a args
+     */
+    template<class... Args>
+      requires (std::constructible_from<ValueType, Args...>)
+    constexpr explicit option (std::in_place_index_t<0>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+      : _value (std::in_place, std::forward<Args> (args)...)
+    {}
+
+    /*!
+     * @brief Constructs ValueType in place from @a args
+     */
+    template<class... Args>
+      requires (std::constructible_from<ValueType, Args...>)
+    constexpr explicit option (std::in_place_type_t<ValueType>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+      : option (std::in_place_index<0>, std::forward<Args> (args)...)
+    {}
+
     /*!
      * @brief Leaves the option empty
      */
@@ -50,9 +70,9 @@ namespace ml::movar
 
     template<internal::movar::DiffUnqual<option> Other>
       requires (internal::movar::can_explicit_cast<Other, option>)
-    explicit(!internal::movar::can_implicit_cast<Other, option>) constexpr option (Other other) //
-      noexcept (noexcept (option (internal::movar::impl::cast<option> (std::move (other)))))    //
-      : option (internal::movar::impl::cast<option> (std::move (other)))
+    explicit(!internal::movar::can_implicit_cast<Other, option>) constexpr option (Other&& other)      //
+      noexcept (noexcept (option (internal::movar::impl::cast<option> (std::forward<Other> (other))))) //
+      : option (internal::movar::impl::cast<option> (std::forward<Other> (other)))
     {}
 
     //! @name Observers
@@ -119,71 +139,227 @@ namespace ml::movar
     /*!
      * @brief getter given index (overload 1)
      * @tparam Index must be 0
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<option, Index>)
-    [[nodiscard]] constexpr const_reference get () const& noexcept
+    [[nodiscard]] constexpr const_reference get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *_value;
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given index (overload 2)
      * @tparam Index must be 0
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<option, Index>)
-    [[nodiscard]] constexpr reference get () & noexcept
+    [[nodiscard]] constexpr reference get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *_value;
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given index (overload 3)
      * @tparam Index must be 0
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     * @note the result refers to the option, see extract to move the value out of a temporary
      */
     template<long Index>
       requires (internal::movar::ContainsIndex<option, Index>)
-    [[nodiscard]] constexpr value_type get () &&                  //
-      noexcept (std::is_nothrow_move_constructible_v<value_type>) //
+    [[nodiscard]] constexpr value_type&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return std::move (*_value);
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given type (overload 1)
      * @tparam T must be @a ValueType
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T = value_type>
       requires (internal::movar::ContainsAlternative<option, T>)
-    [[nodiscard]] constexpr const_reference get () const& noexcept
+    [[nodiscard]] constexpr const_reference get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *_value;
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief getter given type (overload 1)
      * @tparam T must be @a ValueType
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T = value_type>
       requires (internal::movar::ContainsAlternative<option, T>)
-    [[nodiscard]] constexpr reference get () & noexcept
+    [[nodiscard]] constexpr reference get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *_value;
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief getter given type (overload 1)
      * @tparam T must be @a ValueType
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     * @note the result refers to the option, see extract to move the value out of a temporary
      */
     template<class T = value_type>
       requires (internal::movar::ContainsAlternative<option, T>)
-    [[nodiscard]] constexpr value_type get () &&                  //
-      noexcept (std::is_nothrow_move_constructible_v<value_type>) //
+    [[nodiscard]] constexpr value_type&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<T> ();
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 1)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<option, Index>)
+    [[nodiscard]] constexpr const_reference get_unchecked () const& noexcept
+    {
+      return *_value;
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 2)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<option, Index>)
+    [[nodiscard]] constexpr reference get_unchecked () & noexcept
+    {
+      return *_value;
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 3)
+     * @tparam Index must be 0
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<option, Index>)
+    [[nodiscard]] constexpr value_type&& get_unchecked () && noexcept
     {
       return std::move (*_value);
     }
 
+    /*!
+     * @brief unchecked getter given type (overload 1)
+     * @tparam T must be @a ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (internal::movar::ContainsAlternative<option, T>)
+    [[nodiscard]] constexpr const_reference get_unchecked () const& noexcept
+    {
+      return *_value;
+    }
+
+    /*!
+     * @brief unchecked getter given type (overload 1)
+     * @tparam T must be @a ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (internal::movar::ContainsAlternative<option, T>)
+    [[nodiscard]] constexpr reference get_unchecked () & noexcept
+    {
+      return *_value;
+    }
+
+    /*!
+     * @brief unchecked getter given type (overload 1)
+     * @tparam T must be @a ValueType
+     * @pre @a T is the active alternative
+     */
+    template<class T = value_type>
+      requires (internal::movar::ContainsAlternative<option, T>)
+    [[nodiscard]] constexpr value_type&& get_unchecked () && noexcept
+    {
+      return std::move (*_value);
+    }
+
+    /*!
+     * @brief Moves the value out of the option
+     * @tparam Index must be 0
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and the option is empty
+     *
+     * Unlike the rvalue getters, the result is a value that does not refer to the option, so it is safe to
+     * bind it to a reference that outlives a temporary option.
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<option, Index>)
+    [[nodiscard]] constexpr value_type extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS && std::is_nothrow_move_constructible_v<value_type>)
+    {
+      return std::move (*this).template get<Index> ();
+    }
+
+    /*!
+     * @brief Moves the value out of the option
+     * @tparam T must be ValueType
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and the option is empty
+     */
+    template<class T = value_type>
+      requires (internal::movar::ContainsAlternative<option, T>)
+    [[nodiscard]] constexpr value_type extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS && std::is_nothrow_move_constructible_v<value_type>)
+    {
+      return std::move (*this).template get<T> ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Destroys the value, if any, and constructs ValueType from @a args
+     * @tparam Index must be 0
+     * @return the new value
+     */
+    template<long Index, class... Args>
+      requires (internal::movar::ContainsIndex<option, Index> && std::constructible_from<ValueType, Args...>)
+    constexpr reference emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+    {
+      return _value.emplace (std::forward<Args> (args)...);
+    }
+
+    /*!
+     * @brief Destroys the value, if any, and constructs ValueType from @a args
+     * @tparam T must be ValueType
+     * @return the new value
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<option, T> //
+        && std::constructible_from<ValueType, Args...>)
+    constexpr reference emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<ValueType, Args...>)
+    {
+      return _value.emplace (std::forward<Args> (args)...);
+    }
+
     //! @}
     //! @name Friends
     //! @{
@@ -258,6 +434,24 @@ namespace ml::movar
       return internal::movar::impl::map (std::move (*this), std::move (vis));
     }
 
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const&
+    {
+      return deferred_map<option const&, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) &&
+    {
+      return deferred_map<option, Vis> {std::move (*this), std::move (vis)};
+    }
+
     /*!
      * @brief see [pipelines documentation](#pipelines-match)
      */
@@ -0,0 +1,100 @@
+#pragma once
+#include <ml/movar/internal/type/maybe_ref.hpp>
+#include <ml/movar/internal/type/variant_ref.hpp>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::just<T&>
+   * @brief A reference, stored as a pointer.
+   * @ingroup Variant
+   *
+   * Variants whose alternatives are all lvalue references are views: they behave as
+   * ml::movar::variant_ref or ml::movar::maybe_ref, and visitors receive the referenced objects
+   * without copying. Mixing reference and object alternatives in one variant is not supported.
+   */
+  template<class T>
+  struct just<T&> : variant_ref<T>
+  {
+    using value_type = T&;
+    using reference = T&;
+    using const_reference = T&;
+
+    using variant_ref<T>::variant_ref;
+    using variant_ref<T>::get;
+
+    /*!
+     * @return the referenced object
+     */
+    [[nodiscard]] constexpr T& get () const noexcept
+    {
+      return this->template get_unchecked<0> ();
+    }
+  };
+
+  /*! @class ml::movar::option<T&>
+   * @brief An optional reference, stored as a pointer.
+   * @ingroup Variant
+   *
+   * See ml::movar::just<T&>.
+   */
+  template<class T>
+  struct option<T&> : maybe_ref<T>
+  {
+    using value_type = T&;
+    using reference = T&;
+    using const_reference = T&;
+
+    using maybe_ref<T>::maybe_ref;
+    using maybe_ref<T>::get;
+
+    /*!
+     * @return the referenced object
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and the option is empty
+     */
+    [[nodiscard]] constexpr T& get () const noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      return this->template get<0> ();
+    }
+  };
+
+  /*! @class ml::movar::either<T1&, T2&>
+   * @brief One of two references, stored as a pointer.
+   * @ingroup Variant
+   *
+   * See ml::movar::just<T&>.
+   */
+  template<class T1, class T2>
+  struct either<T1&, T2&> : variant_ref<T1, T2>
+  {
+    using first_type = T1&;
+    using second_type = T2&;
+
+    using variant_ref<T1, T2>::variant_ref;
+  };
+
+  /*! @class ml::movar::variant<Ts&...>
+   * @brief One of many references, stored as a pointer.
+   * @ingroup Variant
+   *
+   * See ml::movar::just<T&>.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct variant<Ts&...> : variant_ref<Ts...>
+  {
+    using variant_ref<Ts...>::variant_ref;
+  };
+
+  /*! @class ml::movar::maybe<Ts&...>
+   * @brief One of many references or nothing, stored as a pointer.
+   * @ingroup Variant
+   *
+   * See ml::movar::just<T&>.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct maybe<Ts&...> : maybe_ref<Ts...>
+  {
+    using maybe_ref<Ts...>::maybe_ref;
+  };
+} // namespace ml::movar
\ No newline at end of file
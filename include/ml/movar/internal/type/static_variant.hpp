@@ -0,0 +1,239 @@
+#pragma once
+#include <ml/movar/internal/core/core.hpp>
+#include <utility>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::known_t
+   * @brief Tag type asserting that the active index of a variant is @a Index
+   * @ingroup Variant
+   */
+  template<long Index>
+  struct known_t
+  {
+    static constexpr long value = Index;
+
+    explicit known_t () = default;
+  };
+
+  /*!
+   * @brief Tag asserting that the active index of a variant is @a Index
+   * @ingroup Variant
+   */
+  template<long Index>
+  inline constexpr known_t<Index> known {};
+
+  /*! @class ml::movar::static_variant
+   * @brief A variant whose active index @a Index is known at compile time.
+   * @ingroup Variant
+   * @nosubgrouping
+   *
+   * A static_variant stands for a ml::movar::variant of @a Ts holding the alternative at @a Index, and stores
+   * only that alternative. Its pipeline operations accept the same functions and compute the same values
+   * as those of the dynamic variant, but invoke the function directly instead of dispatching on the index.
+   *
+   * When a function returns a plain value, its index in the dynamic result is known too, so the result is
+   * again a static_variant and the following stages also dispatch statically. A function returning a
+   * Variant ends the static chain. A static_variant converts implicitly to every Variant containing its
+   * active alternative, and lazy pipelines invoked on it receive its active alternative.
+   */
+  template<long Index, class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct static_variant
+  {
+    static_assert (Index >= 0 && Index < static_cast<long> (sizeof...(Ts)));
+    static_assert ((std::is_object_v<Ts> && ...));
+
+    //! The variant type this static_variant stands for
+    using dynamic_type = internal::movar::simplify<variant<Ts...>>;
+    using value_type = internal::movar::alternative<dynamic_type, Index>;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+
+    value_type _value;
+
+    /*!
+     * @brief Move-constructs the active alternative
+     */
+    constexpr static_variant (value_type value) //
+      noexcept (std::is_nothrow_move_constructible_v<value_type>)
+      : _value (std::move (value))
+    {}
+
+    /*!
+     * @brief Constructs the active alternative in place from @a args
+     */
+    template<class... Args>
+      requires (std::constructible_from<value_type, Args...>)
+    constexpr explicit static_variant (std::in_place_t, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<value_type, Args...>)
+      : _value (std::forward<Args> (args)...)
+    {}
+
+    /*!
+     * @brief Takes the active alternative of @a var
+     * @pre the active index of @a var is @a Index
+     */
+    template<class Var>
+      requires (Variant<std::remove_cvref_t<Var>> && !None<std::remove_cvref_t<Var>>
+        && std::same_as<internal::movar::alternative<std::remove_cvref_t<Var>, Index>, value_type>)
+    constexpr static_variant (known_t<Index>, Var&& var)
+      : _value (std::forward<Var> (var).template get_unchecked<Index> ())
+    {}
+
+    /*!
+     * @brief Converts to a variant holding the active alternative
+     */
+    template<Variant To>
+      requires (internal::movar::ContainsAlternative<To, value_type>)
+    [[nodiscard]] constexpr operator To () const&
+    {
+      return To (std::in_place_index<internal::movar::alternative_index<To, value_type>>, _value);
+    }
+
+    /*!
+     * @brief Converts to a variant holding the active alternative
+     */
+    template<Variant To>
+      requires (internal::movar::ContainsAlternative<To, value_type>)
+    [[nodiscard]] constexpr operator To () &&
+    {
+      return To (std::in_place_index<internal::movar::alternative_index<To, value_type>>, std::move (_value));
+    }
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return @a Index
+     */
+    [[nodiscard]] static constexpr long index () noexcept
+    {
+      return Index;
+    }
+
+    /*!
+     * @return false
+     */
+    [[nodiscard]] static constexpr bool is_nothing () noexcept
+    {
+      return false;
+    }
+
+    /*!
+     * @return true
+     */
+    [[nodiscard]] static constexpr bool is_something () noexcept
+    {
+      return true;
+    }
+
+    //! @}
+    //! @name Getters
+    //! @{
+
+    /*!
+     * @return the active alternative
+     */
+    [[nodiscard]] constexpr const_reference get () const& noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @return the active alternative
+     */
+    [[nodiscard]] constexpr reference get () & noexcept
+    {
+      return _value;
+    }
+
+    /*!
+     * @return the active alternative
+     */
+    [[nodiscard]] constexpr value_type&& get () && noexcept
+    {
+      return std::move (_value);
+    }
+
+    //! @}
+    //! @name Pipeline
+    //! @{
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::WeakVisitor<dynamic_type const&> Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) const&
+    {
+      return internal::movar::impl::static_map (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::WeakVisitor<dynamic_type&&> Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) &&
+    {
+      return internal::movar::impl::static_map (std::move (*this), std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::Visitor<dynamic_type const&> Vis>
+    constexpr auto match (Vis vis) const&
+    {
+      return internal::movar::impl::static_match (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::Visitor<dynamic_type&&> Vis>
+    constexpr auto match (Vis vis) &&
+    {
+      return internal::movar::impl::static_match (std::move (*this), std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::Lazy Default>
+    [[nodiscard]] constexpr auto or_else (Default lazy) const&
+    {
+      return internal::movar::impl::static_or_else (*this, std::move (lazy));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-static)
+     */
+    template<internal::movar::Lazy Default>
+    [[nodiscard]] constexpr auto or_else (Default lazy) &&
+    {
+      return internal::movar::impl::static_or_else (std::move (*this), std::move (lazy));
+    }
+
+    //! @}
+
+    /*!
+     * @brief default equality
+     */
+    bool operator== (static_variant const&) const = default;
+  };
+
+  template<long Index, class... Ts>
+  static_variant (known_t<Index>, variant<Ts...> const&) -> static_variant<Index, Ts...>;
+
+  template<long Index, class... Ts>
+  static_variant (known_t<Index>, maybe<Ts...> const&) -> static_variant<Index, Ts...>;
+
+  template<long Index, class T1, class T2>
+  static_variant (known_t<Index>, either<T1, T2> const&) -> static_variant<Index, T1, T2>;
+
+  template<long Index, class T>
+  static_variant (known_t<Index>, just<T> const&) -> static_variant<Index, T>;
+
+  template<long Index, class T>
+  static_variant (known_t<Index>, option<T> const&) -> static_variant<Index, T>;
+} // namespace ml::movar
\ No newline at end of file
@@ -2,6 +2,10 @@
 #include <ml/movar/internal/type/either.hpp>
 #include <ml/movar/internal/type/just.hpp>
 #include <ml/movar/internal/type/maybe.hpp>
+#include <ml/movar/internal/type/maybe_ref.hpp>
 #include <ml/movar/internal/type/nothing.hpp>
 #include <ml/movar/internal/type/option.hpp>
+#include <ml/movar/internal/type/reference.hpp>
+#include <ml/movar/internal/type/static_variant.hpp>
 #include <ml/movar/internal/type/variant.hpp>
+#include <ml/movar/internal/type/variant_ref.hpp>
\ No newline at end of file
@@ -35,11 +35,33 @@ namespace ml::movar
       : _value (std::move (value))
     {}
 
+    /*!
+     * @brief Constructs the alternative at @a Index in place from @a args
+     */
+    template<std::size_t Index, class... Args>
+      requires (Index < sizeof...(Ts) //
+        && std::constructible_from<internal::movar::alternative<variant, Index>, Args...>)
+    constexpr explicit variant (std::in_place_index_t<Index>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<internal::movar::alternative<variant, Index>, Args...>)
+      : _value (std::in_place_index<Index>, std::forward<Args> (args)...)
+    {}
+
+    /*!
+     * @brief Constructs the alternative @a T in place from @a args
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<variant, T> && std::constructible_from<T, Args...>)
+    constexpr explicit variant (std::in_place_type_t<T>, Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<T, Args...>)
+      : variant (std::in_place_index<internal::movar::alternative_index<variant, T>>, //
+        std::forward<Args> (args)...)
+    {}
+
     template<internal::movar::DiffUnqual<variant> Other>
       requires (internal::movar::can_explicit_cast<Other, variant>)
-    explicit(!internal::movar::can_implicit_cast<Other, variant>) constexpr variant (Other other) //
-      noexcept (noexcept (variant (internal::movar::impl::cast<variant> (std::move (other)))))    //
-      : variant (internal::movar::impl::cast<variant> (std::move (other)))
+    explicit(!internal::movar::can_implicit_cast<Other, variant>) constexpr variant (Other&& other)      //
+      noexcept (noexcept (variant (internal::movar::impl::cast<variant> (std::forward<Other> (other))))) //
+      : variant (internal::movar::impl::cast<variant> (std::forward<Other> (other)))
     {}
 
     //! @name Observers
@@ -106,69 +128,236 @@ namespace ml::movar
     /*!
      * @brief getter given index (overload 1)
      * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
-      requires (internal::movar::ContainsIndex<variant, Index> || Index == -1)
-    [[nodiscard]] constexpr auto const& get () const& noexcept
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto const& get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<Index> (&_value);
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given index (overload 2)
      * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
      */
     template<long Index>
-      requires (internal::movar::ContainsIndex<variant, Index> || Index == -1)
-    [[nodiscard]] constexpr auto& get () & noexcept
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto& get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<Index> (&_value);
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given index (overload 3)
      * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     * @note the result refers to the variant, see extract to move the value out of a temporary
      */
     template<long Index>
-      requires (internal::movar::ContainsIndex<variant, Index> || Index == -1)
-    [[nodiscard]] constexpr auto get () &&
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return std::move (*std::get_if<Index> (&_value));
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<Index> ();
     }
 
     /*!
      * @brief getter given type (overload 1)
      * @tparam T must be an alternative
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<variant, T>)
-    [[nodiscard]] constexpr T const& get () const& noexcept
+    [[nodiscard]] constexpr T const& get () const& //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<T> (&_value);
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief getter given type (overload 2)
      * @tparam T must be an alternative
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<variant, T>)
-    [[nodiscard]] constexpr T& get () & noexcept
+    [[nodiscard]] constexpr T& get () & //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
     {
-      return *std::get_if<T> (&_value);
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
     }
 
     /*!
      * @brief getter given type (overload 3)
      * @tparam T must be an alternative
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     * @note the result refers to the variant, see extract to move the value out of a temporary
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant, T>)
+    [[nodiscard]] constexpr T&& get () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return std::move (*this).template get_unchecked<T> ();
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 1)
+     * @tparam Index must be in [0, size)
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto const& get_unchecked () const& noexcept
+    {
+      return *std::get_if<Index> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 2)
+     * @tparam Index must be in [0, size)
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto& get_unchecked () & noexcept
+    {
+      return *std::get_if<Index> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given index (overload 3)
+     * @tparam Index must be in [0, size)
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto&& get_unchecked () && noexcept
+    {
+      return std::move (*std::get_if<Index> (&_value));
+    }
+
+    /*!
+     * @brief unchecked getter given type (overload 1)
+     * @tparam T must be an alternative
+     * @pre @a T is the active alternative
      */
     template<class T>
       requires (internal::movar::ContainsAlternative<variant, T>)
-    [[nodiscard]] constexpr T get () &&
+    [[nodiscard]] constexpr T const& get_unchecked () const& noexcept
+    {
+      return *std::get_if<T> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given type (overload 2)
+     * @tparam T must be an alternative
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant, T>)
+    [[nodiscard]] constexpr T& get_unchecked () & noexcept
+    {
+      return *std::get_if<T> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given type (overload 3)
+     * @tparam T must be an alternative
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant, T>)
+    [[nodiscard]] constexpr T&& get_unchecked () && noexcept
     {
       return std::move (*std::get_if<T> (&_value));
     }
 
+    /*!
+     * @brief Moves the alternative at @a Index out of the variant
+     * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     *
+     * Unlike the rvalue getters, the result is a value that does not refer to the variant, so it is safe to
+     * bind it to a reference that outlives a temporary variant.
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant, Index>)
+    [[nodiscard]] constexpr auto extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS
+        && std::is_nothrow_move_constructible_v<internal::movar::alternative<variant, Index>>)
+    {
+      return std::move (*this).template get<Index> ();
+    }
+
+    /*!
+     * @brief Moves the alternative @a T out of the variant
+     * @tparam T must be an alternative
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant, T>)
+    [[nodiscard]] constexpr T extract () && //
+      noexcept (!ML_MOVAR_THROWING_ACCESS && std::is_nothrow_move_constructible_v<T>)
+    {
+      return std::move (*this).template get<T> ();
+    }
+
+    //! @}
+    //! @name Modifiers
+    //! @{
+
+    /*!
+     * @brief Destroys the active alternative and constructs the alternative at @a Index from @a args
+     * @return the new alternative
+     *
+     * The alternative is constructed in place when that cannot throw, otherwise it is constructed aside
+     * and moved in, so that a throwing constructor leaves the variant unchanged.
+     */
+    template<long Index, class... Args>
+      requires (internal::movar::ContainsIndex<variant, Index>
+        && std::constructible_from<internal::movar::alternative<variant, Index>, Args...>
+        && (std::is_nothrow_constructible_v<internal::movar::alternative<variant, Index>, Args...>
+          || std::is_nothrow_move_constructible_v<internal::movar::alternative<variant, Index>>))
+    constexpr auto& emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<internal::movar::alternative<variant, Index>, Args...>)
+    {
+      using type = internal::movar::alternative<variant, Index>;
+      if constexpr (std::is_nothrow_constructible_v<type, Args...>)
+        return _value.template emplace<Index> (std::forward<Args> (args)...);
+      else
+        return _value.template emplace<Index> (type (std::forward<Args> (args)...));
+    }
+
+    /*!
+     * @brief Destroys the active alternative and constructs the alternative @a T from @a args
+     * @return the new alternative
+     */
+    template<class T, class... Args>
+      requires (internal::movar::ContainsAlternative<variant, T> && std::constructible_from<T, Args...>
+        && (std::is_nothrow_constructible_v<T, Args...> || std::is_nothrow_move_constructible_v<T>))
+    constexpr T& emplace (Args&&... args) //
+      noexcept (std::is_nothrow_constructible_v<T, Args...>)
+    {
+      return emplace<internal::movar::alternative_index<variant, T>> (std::forward<Args> (args)...);
+    }
+
     //! @}
     //! @name Friends
     //! @{
@@ -242,6 +431,24 @@ namespace ml::movar
       return internal::movar::impl::map (std::move (*this), std::move (vis));
     }
 
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const&
+    {
+      return deferred_map<variant const&, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) &&
+    {
+      return deferred_map<variant, Vis> {std::move (*this), std::move (vis)};
+    }
+
     /*!
      * @brief see [pipelines documentation](#pipelines-match)
      */
@@ -0,0 +1,300 @@
+#pragma once
+#include <ml/movar/internal/type/nothing.hpp>
+#include <memory>
+#include <variant>
+
+namespace ml::movar
+{
+  /*! @class ml::movar::variant_ref
+   * @brief A non-owning view of an object that is one of many alternatives.
+   * @ingroup Variant
+   *
+   * A variant_ref holds the active index and a pointer to an object stored elsewhere, such as the active
+   * alternative of an owning variant or a payload decoded in place from a buffer.
+   *
+   * Its alternatives are the references @a Ts&: visitors receive the referenced object itself,
+   * whatever the constness and value category of the view. Declare an alternative const for read-only
+   * access. The referenced object must outlive the view.
+   */
+  template<class... Ts>
+    requires (sizeof...(Ts) > 0)
+  struct variant_ref
+  {
+    static_assert ((!std::is_volatile_v<Ts> && ...));
+    static_assert ((std::is_object_v<Ts> && ...));
+
+    //! Untyped pointer to a payload, const if every alternative is const
+    using erased_pointer = std::conditional_t<(std::is_const_v<Ts> && ...), void const*, void*>;
+
+    std::variant<Ts*...> _value;
+
+    /*!
+     * @brief Refers to @a ref
+     */
+    template<class T>
+      requires (internal::movar::ContainsReferenceTo<variant_ref, T>)
+    constexpr variant_ref (T& ref) noexcept
+      : _value (std::in_place_index<internal::movar::reference_index<variant_ref, T>>, //
+          std::addressof (ref))
+    {}
+
+    /*!
+     * @brief Refers to @a ref as the alternative at @a Index
+     */
+    template<std::size_t Index>
+      requires (Index < sizeof...(Ts))
+    constexpr variant_ref (std::in_place_index_t<Index>, //
+      internal::movar::alternative<variant_ref, Index> ref) noexcept
+      : _value (std::in_place_index<Index>, std::addressof (ref))
+    {}
+
+    /*!
+     * @brief Refers to @a payload as the alternative at @a index
+     * @pre @a index is in [0, size) and @a payload points to an object of that alternative
+     */
+    variant_ref (long index, erased_pointer payload) noexcept
+      : _value (boost::mp11::mp_with_index<sizeof...(Ts)> (index, [payload] (auto I) {
+        using pointer = std::remove_reference_t<internal::movar::alternative<variant_ref, I>>*;
+        return std::variant<Ts*...> (std::in_place_index<I>, static_cast<pointer> (payload));
+      }))
+    {}
+
+    /*!
+     * @brief Refers to the active alternative of @a owner
+     */
+    template<class Owner>
+      requires (internal::movar::can_view<variant_ref, Owner> && Some<std::remove_const_t<Owner>>)
+    constexpr variant_ref (Owner& owner) noexcept
+      : _value (boost::mp11::mp_with_index<sizeof...(Ts)> (owner.index (), [&owner] (auto I) {
+        auto& alternative = owner.template get_unchecked<I> ();
+        return std::variant<Ts*...> (std::in_place_index<I>, std::addressof (alternative));
+      }))
+    {}
+
+    //! @name Observers
+    //! @{
+
+    /*!
+     * @return the active index
+     */
+    [[nodiscard]] constexpr long index () const noexcept
+    {
+      return static_cast<long> (_value.index ());
+    }
+
+    /*!
+     * @return false
+     */
+    [[nodiscard]] constexpr bool is_nothing () const noexcept
+    {
+      return false;
+    }
+
+    /*!
+     * @return true
+     */
+    [[nodiscard]] constexpr bool is_something () const noexcept
+    {
+      return true;
+    }
+
+    /*!
+     * @return true if @a Index equals the active index
+     * @tparam Index must be in [-1, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant_ref, Index> || Index == -1)
+    [[nodiscard]] constexpr bool is () const noexcept
+    {
+      return index () == Index;
+    }
+
+    /*!
+     * @return true if the view refers to an object of type @a T
+     * @tparam T must be a referenced type or ml::movar::nothing
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant_ref, T&> || std::same_as<T, nothing>)
+    [[nodiscard]] constexpr bool is () const noexcept
+    {
+      if constexpr (std::same_as<T, nothing>) {
+        return false;
+      } else {
+        return std::holds_alternative<T*> (_value);
+      }
+    }
+
+    //! @}
+    //! @name Getters
+    //! @{
+
+    /*!
+     * @brief getter given index
+     * @tparam Index must be in [0, size)
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a Index is not active
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant_ref, Index>)
+    [[nodiscard]] constexpr auto& get () const noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<Index> ())
+        internal::movar::bad_access ();
+      return get_unchecked<Index> ();
+    }
+
+    /*!
+     * @brief getter given type
+     * @tparam T must be a referenced type
+     * @throws std::bad_variant_access if ML_MOVAR_THROWING_ACCESS and @a T is not active
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant_ref, T&>)
+    [[nodiscard]] constexpr T& get () const noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      if (!is<T> ())
+        internal::movar::bad_access ();
+      return get_unchecked<T> ();
+    }
+
+    /*!
+     * @brief unchecked getter given index
+     * @tparam Index must be in [0, size)
+     * @pre @a Index is the active alternative
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant_ref, Index>)
+    [[nodiscard]] constexpr auto& get_unchecked () const noexcept
+    {
+      return **std::get_if<Index> (&_value);
+    }
+
+    /*!
+     * @brief unchecked getter given type
+     * @tparam T must be a referenced type
+     * @pre @a T is the active alternative
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant_ref, T&>)
+    [[nodiscard]] constexpr T& get_unchecked () const noexcept
+    {
+      return **std::get_if<T*> (&_value);
+    }
+
+    //! @}
+    //! @name Friends
+    //! @{
+
+    /*!
+     * @return true if @a Index equals the active index
+     * @tparam Index must be in [-1, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant_ref, Index> || Index == -1)
+    [[nodiscard]] friend constexpr bool is (variant_ref const& self) noexcept
+    {
+      return self.template is<Index> ();
+    }
+
+    /*!
+     * @return true if the view refers to an object of type @a T
+     * @tparam T must be a referenced type or ml::movar::nothing
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant_ref, T&> || std::same_as<T, nothing>)
+    [[nodiscard]] friend constexpr bool is (variant_ref const& self) noexcept
+    {
+      return self.template is<T> ();
+    }
+
+    /*!
+     * @brief getter given index
+     * @tparam Index must be in [0, size)
+     */
+    template<long Index>
+      requires (internal::movar::ContainsIndex<variant_ref, Index>)
+    [[nodiscard]] friend constexpr auto& get (variant_ref const& self) noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      return self.template get<Index> ();
+    }
+
+    /*!
+     * @brief getter given type
+     * @tparam T must be a referenced type
+     */
+    template<class T>
+      requires (internal::movar::ContainsAlternative<variant_ref, T&>)
+    [[nodiscard]] friend constexpr T& get (variant_ref const& self) noexcept (!ML_MOVAR_THROWING_ACCESS)
+    {
+      return self.template get<T> ();
+    }
+
+    //! @}
+    //! @name Pipeline
+    //! @{
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map  )
+     */
+    template<internal::movar::WeakVisitor<variant_ref const&> Vis>
+    [[nodiscard]] constexpr auto map (Vis vis) const
+    {
+      return internal::movar::impl::map (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [lazy-pipelines documentation](#lazy-pipelines-lazy_map)
+     */
+    template<std::move_constructible Vis>
+    [[nodiscard]] constexpr auto lazy_map (Vis vis) const
+    {
+      return deferred_map<variant_ref, Vis> {*this, std::move (vis)};
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-match)
+     */
+    template<internal::movar::Visitor<variant_ref const&> Vis>
+    constexpr auto match (Vis vis) const
+    {
+      return internal::movar::impl::match (*this, std::move (vis));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map_or)
+     */
+    template<internal::movar::WeakVisitor<variant_ref const&> Vis, std::move_constructible Default>
+    [[nodiscard]] constexpr auto map_or (Vis vis, Default def) const
+    {
+      return internal::movar::impl::map_or (*this, std::move (vis), std::move (def));
+    }
+
+    /*!
+     * @brief see [pipelines documentation](#pipelines-map_or_else)
+     */
+    template<internal::movar::WeakVisitor<variant_ref const&> Vis, internal::movar::Lazy Default>
+    [[nodiscard]] constexpr auto map_or_else (Vis vis, Default def) const
+    {
+      return internal::movar::impl::map_or_else (*this, std::move (vis), std::move (def));
+    }
+
+    //! @}
+  };
+
+  template<class... Ts>
+  variant_ref (variant<Ts...>&) -> variant_ref<Ts...>;
+
+  template<class... Ts>
+  variant_ref (variant<Ts...> const&) -> variant_ref<Ts const...>;
+
+  template<class T1, class T2>
+  variant_ref (either<T1, T2>&) -> variant_ref<T1, T2>;
+
+  template<class T1, class T2>
+  variant_ref (either<T1, T2> const&) -> variant_ref<T1 const, T2 const>;
+
+  template<class T>
+  variant_ref (just<T>&) -> variant_ref<T>;
+
+  template<class T>
+  variant_ref (just<T> const&) -> variant_ref<T const>;
+} // namespace ml::movar
\ No newline at end of file
@@ -0,0 +1,4 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <ml/movar/internal/serialize/archive.hpp>
+#include <ml/movar/internal/serialize/binary.hpp>
\ No newline at end of file
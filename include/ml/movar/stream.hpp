@@ -0,0 +1,5 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <ml/movar/internal/stream/framing.hpp>
+#include <ml/movar/internal/stream/mapped_file.hpp>
+#include <ml/movar/internal/stream/stream.hpp>
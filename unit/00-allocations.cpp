@@ -0,0 +1,26 @@
+#include "common.hpp"
+#include <cstdlib>
+#include <new>
+
+// Counts allocations for the budgets of the accounting test. The replacements live in their own
+// translation unit, linked into every driver, so that they are never inlined into a caller where the
+// compiler would pair a std::free with the operator new that returned the pointer. The array forms
+// default to these, and the aligned forms keep their own matching pair.
+void* operator new (std::size_t size)
+{
+  ++testing::allocations;
+  void* p = std::malloc (size == 0 ? 1 : size);
+  if (p == nullptr)
+    std::abort ();
+  return p;
+}
+
+void operator delete (void* p) noexcept
+{
+  std::free (p);
+}
+
+void operator delete (void* p, std::size_t) noexcept
+{
+  std::free (p);
+}
\ No newline at end of file
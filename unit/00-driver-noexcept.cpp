@@ -0,0 +1,22 @@
+#include "01-constexpr.hpp"
+#include "02-stream.hpp"
+#include "03-fusion.hpp"
+#include "04-cast.hpp"
+#include "05-access.hpp"
+#include "06-canonical.hpp"
+#include "07-emplace.hpp"
+#include "08-rvalue.hpp"
+#include "09-view.hpp"
+#include "10-reference.hpp"
+#include "11-deferred.hpp"
+#include "12-static.hpp"
+#include "13-flatten.hpp"
+#include "14-accounting.hpp"
+#include "15-hash.hpp"
+#include "16-flat.hpp"
+#include "17-collection.hpp"
+#include "18-column.hpp"
+#include "19-partition.hpp"
+#include "20-serialize.hpp"
+#include "21-archive.hpp"
+#include "22-atomic.hpp"
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/stream.hpp>
+#include <doctest/doctest.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE ("stream")
+{
+  using namespace ml::movar;
+  using testing::temp_file;
+
+  auto const to_int = [] (std::string_view record) -> option<int> {
+    if (record.empty ())
+      return nothing ();
+    int value = 0;
+    for (char c : record)
+      value = value * 10 + (c - '0');
+    return value;
+  };
+  auto const is_even = [] (int x) {
+    return x % 2 == 0;
+  };
+  auto const pipeline = sequence () >> to_int >> filter (is_even);
+
+  std::string lines;
+  std::vector<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    lines += std::to_string (i) + "\n";
+    if (i % 2 == 0)
+      expected.push_back (i);
+  }
+  temp_file const lines_file ("movar-stream-lines.txt", lines);
+  auto const& lines_path = lines_file.path;
+
+  SUBCASE ("framing")
+  {
+    static_assert (Framing<delimited>);
+    static_assert (Framing<length_prefixed<>>);
+
+    std::string_view input = "a\n\nbc\n";
+    CHECK (delimited ().next (input) == std::string_view ("a"));
+    CHECK (delimited ().next (input) == std::string_view (""));
+    CHECK (delimited ().next (input) == std::string_view ("bc"));
+    CHECK (delimited ().next (input) == nothing ());
+
+    CHECK (delimited ().align ("ab\ncd\n", 1) == 3);
+    CHECK (delimited ().align ("ab\ncd\n", 3) == 3);
+    CHECK (delimited ().align ("ab\ncd", 4) == 5);
+
+    std::string framed {'\x02', '\0', 'h', 'i', '\x00', '\0', '\x01', '\0'};
+    input = framed;
+    CHECK (length_prefixed<std::uint16_t> ().next (input) == std::string_view ("hi"));
+    CHECK (length_prefixed<std::uint16_t> ().next (input) == std::string_view (""));
+    CHECK (length_prefixed<std::uint16_t> ().next (input) == nothing ());
+    CHECK (length_prefixed<std::uint16_t> ().align (framed, 1) == 4);
+  }
+
+  SUBCASE ("sequential")
+  {
+    std::vector<int> seen;
+    auto const stats = stream (lines_path, delimited (), pipeline, [&] (int x) {
+      seen.push_back (x);
+    });
+    CHECK (stats == stream_stats {5000, 2500});
+    CHECK (seen == expected);
+  }
+
+  SUBCASE ("small chunks")
+  {
+    std::vector<int> seen;
+    stream_options options;
+    options.chunk_size = 7;
+    stream (lines_path, delimited (), pipeline, [&] (int x) { seen.push_back (x); }, options);
+    CHECK (seen == expected);
+  }
+
+  SUBCASE ("threads")
+  {
+    std::vector<int> seen;
+    stream_options options;
+    options.chunk_size = 64;
+    options.threads = 4;
+    auto const stats = stream (lines_path, delimited (), pipeline, [&] (int x) { seen.push_back (x); }, options);
+    CHECK (stats == stream_stats {5000, 2500});
+    CHECK (seen == expected);
+  }
+
+  SUBCASE ("length prefixed")
+  {
+    std::string framed;
+    for (std::string_view word : {"alpha", "", "gamma"}) {
+      std::uint32_t const size = word.size ();
+      for (int i = 0; i < 4; ++i)
+        framed += static_cast<char> ((size >> (8 * i)) & 0xff);
+      framed += word;
+    }
+    temp_file const file ("movar-stream-framed.bin", framed);
+    auto const& path = file.path;
+
+    std::vector<std::string> seen;
+    auto const stats = stream (path, length_prefixed (), sequence (), [&] (std::string_view x) {
+      seen.emplace_back (x);
+    });
+    CHECK (stats == stream_stats {3, 3});
+    CHECK (seen == std::vector<std::string> {"alpha", "", "gamma"});
+  }
+
+  SUBCASE ("truncated tail")
+  {
+    using namespace std::string_literals;
+    auto const collect = [] (auto const& file, auto framing, stream_options const& options) {
+      std::vector<std::string> seen;
+      stream (file.path, framing, sequence (), [&] (std::string_view x) { seen.emplace_back (x); }, options);
+      return seen;
+    };
+    stream_options parallel;
+    parallel.chunk_size = 1;
+    parallel.threads = 2;
+    std::vector<std::string> const first {"a"};
+
+    // a record followed by a header cut short
+    temp_file const header ("movar-stream-header.bin", "\x01\0\0\0a\x02\0"s);
+    CHECK (collect (header, length_prefixed (), stream_options ()) == first);
+    CHECK (collect (header, length_prefixed (), parallel) == first);
+
+    // a record followed by a length that would wrap the offset
+    temp_file const length ("movar-stream-length.bin", //
+      "\x01\0\0\0\0\0\0\0a"s + "\xf8\xff\xff\xff\xff\xff\xff\xff"s);
+    CHECK (collect (length, length_prefixed<std::uint64_t> (), stream_options ()) == first);
+    CHECK (collect (length, length_prefixed<std::uint64_t> (), parallel) == first);
+  }
+
+  SUBCASE ("empty file")
+  {
+    temp_file const file ("movar-stream-empty.txt", "");
+    auto const& path = file.path;
+    auto const stats = stream (path, delimited (), pipeline, [] (int) {});
+    CHECK (stats == stream_stats {});
+  }
+
+  SUBCASE ("open")
+  {
+    std::error_code error;
+    option<mapped_file> const missing = mapped_file::open (lines_path.string () + ".missing", error);
+    CHECK (missing.is_nothing ());
+    CHECK (error == std::errc::no_such_file_or_directory);
+
+    option<mapped_file> const file = mapped_file::open (lines_path, error);
+    REQUIRE (file.is_something ());
+    CHECK (!error);
+    CHECK (file.get ().view () == lines);
+  }
+
+  SUBCASE ("ostream sink")
+  {
+    std::ostringstream out;
+    temp_file const file ("movar-stream-small.txt", "1\n2\n3\n4\n");
+    auto const& path = file.path;
+    stream (path, delimited (), pipeline, ostream_sink (out, ','));
+    CHECK (out.str () == "2,4,");
+  }
+}
\ No newline at end of file
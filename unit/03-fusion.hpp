@@ -0,0 +1,136 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE ("fusion")
+{
+  using namespace ml::movar;
+  using ml::internal::movar::all_of;
+  using ml::internal::movar::compose;
+
+  constexpr auto add1 = [] (int x) {
+    return x + 1;
+  };
+  constexpr auto mul2 = [] (int x) {
+    return x * 2;
+  };
+  constexpr auto iseven = [] (int x) {
+    return x % 2 == 0;
+  };
+  constexpr auto positive = [] (int x) {
+    return x > 0;
+  };
+  constexpr auto ifzero = [] (int x) -> option<int> {
+    if (x == 0)
+      return 0;
+    return {};
+  };
+
+  using add1_t = std::remove_const_t<decltype (add1)>;
+  using mul2_t = std::remove_const_t<decltype (mul2)>;
+  using iseven_t = std::remove_const_t<decltype (iseven)>;
+  using positive_t = std::remove_const_t<decltype (positive)>;
+  using ifzero_t = std::remove_const_t<decltype (ifzero)>;
+
+  SUBCASE ("filters")
+  {
+    constexpr auto f = filter (iseven) >> filter (positive);
+    static_assert (std::same_as<decltype (f), filter<all_of<iseven_t, positive_t>> const>);
+
+    constexpr auto unfused = sequence (filter (iseven), filter (positive));
+    static_assert (std::same_as<decltype (f (2)), decltype (unfused (2))>);
+    static_assert (f (2) == 2);
+    static_assert (f (3) == nothing ());
+    static_assert (f (-2) == nothing ());
+
+    // the second predicate still sees the alternatives of a variant argument
+    constexpr auto nonzero = [] (auto x) {
+      return x != 0;
+    };
+    constexpr auto g = filter (nonzero) >> filter ([] (int x) { return x > 1; });
+    static_assert (std::same_as<decltype (g (option (2))), decltype (sequence (filter (nonzero), filter ([] (int x) {
+      return x > 1;
+    })) (option (2)))>);
+    static_assert (g (option (2)) == 2);
+    static_assert (g (option (1)) == nothing ());
+    static_assert (g (option<int> ()) == nothing ());
+  }
+
+  SUBCASE ("maps")
+  {
+    constexpr auto s = sequence () >> add1 >> mul2;
+    static_assert (std::same_as<decltype (s), sequence<compose<sequence<>, compose<add1_t, mul2_t>>> const>);
+
+    constexpr auto unfused = sequence (sequence (sequence (), add1), mul2);
+    static_assert (std::same_as<decltype (s (1)), decltype (unfused (1))>);
+    static_assert (std::same_as<decltype (s (1)), just<int>>);
+    static_assert (s (1) == 4);
+
+    static_assert (std::same_as<decltype (s (option (1))), decltype (unfused (option (1)))>);
+    static_assert (s (option (1)) == 4);
+    static_assert (s (option<int> ()) == nothing ());
+
+    // an identity stage between two stages is dropped
+    constexpr auto f = sequence () >> add1;
+    static_assert (std::same_as<decltype (f >> sequence () >> mul2), decltype (f >> mul2)>);
+    static_assert (std::same_as<decltype (f >> sequence () >> ifzero), decltype (f >> ifzero)>);
+    static_assert (std::same_as<decltype (f >> sequence ()), std::remove_const_t<decltype (f)>>);
+    static_assert ((f >> sequence () >> mul2) (1) == 4);
+    static_assert ((f >> sequence () >> ifzero) (-1) == 0);
+  }
+
+  SUBCASE ("mixed")
+  {
+    constexpr auto s = sequence () >> filter (iseven) >> filter (positive) >> add1 >> ifzero >> mul2;
+    static_assert (std::same_as<decltype (s),
+      sequence<compose<sequence<>,
+        compose<filter<all_of<iseven_t, positive_t>>, compose<add1_t, compose<ifzero_t, mul2_t>>>>> const>);
+
+    constexpr auto unfused = sequence (
+      sequence (sequence (sequence (sequence (sequence (), filter (iseven)), filter (positive)), add1), ifzero),
+      mul2);
+    static_assert (std::same_as<decltype (s (1)), decltype (unfused (1))>);
+    static_assert (std::same_as<decltype (s (1)), option<int>>);
+    static_assert (s (-1) == nothing ());
+    static_assert (s (2) == nothing ());
+
+    constexpr auto t = sequence () >> filter ([] (int x) { return x == -1; }) >> add1 >> ifzero >> mul2;
+    static_assert (t (-1) == 0);
+  }
+
+  SUBCASE ("arguments")
+  {
+    // a stage cannot modify an lvalue argument, with or without fusion
+    struct overwrite
+    {
+      int operator() (int& x) const
+      {
+        x = 42;
+        return 1;
+      }
+
+      int operator() (int const&) const
+      {
+        return 0;
+      }
+    };
+    int a = 1;
+    CHECK ((sequence () >> overwrite {}) (a) == 0);
+    CHECK (sequence (sequence (), overwrite {}) (a) == 0);
+    CHECK (a == 1);
+    CHECK ((sequence () >> overwrite {}) (std::as_const (a)) == 0);
+    CHECK ((sequence () >> overwrite {}) (2) == 0);
+  }
+
+  SUBCASE ("nested")
+  {
+    constexpr auto s = sequence () >> add1 >> add1;
+    constexpr auto w = sequence () >> ifzero >> add1;
+    constexpr auto a = s >> w;
+    constexpr auto b = w >> s;
+    static_assert (a (0) == nothing ());
+    static_assert (a (-2) == 1);
+    static_assert (b (0) == 3);
+    static_assert (b (1) == nothing ());
+  }
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE ("cast")
+{
+  using namespace ml::movar;
+  using ml::internal::movar::can_remap_cast;
+  using ml::internal::movar::cast_index_map;
+
+  SUBCASE ("index map")
+  {
+    static_assert (can_remap_cast<option<int>, maybe<double, int, long>>);
+    static_assert (can_remap_cast<either<int, double>, variant<long, double, int>>);
+    static_assert (!can_remap_cast<either<int, double>, maybe<int, long>>);
+    static_assert (!can_remap_cast<nothing, option<int>>);
+
+    static_assert (cast_index_map<option<int>, maybe<double, int, long>>[0] == 1);
+    static_assert (cast_index_map<either<int, double>, variant<long, double, int>>[0] == 2);
+    static_assert (cast_index_map<either<int, double>, variant<long, double, int>>[1] == 1);
+  }
+
+  SUBCASE ("widening")
+  {
+    using wide = maybe<double, int, long>;
+    static_assert (wide (option (10)).is<int> ());
+    static_assert (wide (option (10)).get<1> () == 10);
+    static_assert (wide (option<int> ()).is_nothing ());
+    static_assert (variant<long, double, int> (either<int, double> (2.5)).get<double> () == 2.5);
+    static_assert (variant<long, double, int> (either<int, double> (7)).get<int> () == 7);
+    static_assert (maybe<long, int> (just (3)).get<int> () == 3);
+  }
+
+  SUBCASE ("narrowing")
+  {
+    static_assert (just (option (10)) == 10);
+    static_assert (either<int, double> (maybe<double, int> (1.5)).get<double> () == 1.5);
+#if ML_MOVAR_THROWING_CAST
+    CHECK_THROWS (just<int> (option<int> ()));
+#endif
+  }
+
+  SUBCASE ("non trivial")
+  {
+    maybe<int, std::string> source (std::string ("movar"));
+    variant<std::string, int> dest (std::move (source).take ());
+    CHECK (dest.get<std::string> () == "movar");
+  }
+}
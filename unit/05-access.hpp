@@ -0,0 +1,55 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE ("access")
+{
+  using namespace ml::movar;
+
+  SUBCASE ("try_cast")
+  {
+    static_assert (std::same_as<decltype (try_cast<just<int>> (option (10))), option<just<int>>>);
+    static_assert (try_cast<just<int>> (option (10)) == just (10));
+    static_assert (try_cast<just<int>> (option<int> ()) == nothing ());
+    static_assert (try_cast<either<int, double>> (maybe<double, int> (2.5)).get ().get<double> () == 2.5);
+    static_assert (try_cast<either<int, double>> (maybe<double, int> ()).is_nothing ());
+    static_assert (try_cast<maybe<int, long>> (option<int> ()).is_something ());
+    static_assert (try_cast<maybe<int, long>> (option<int> ()).get ().is_nothing ());
+    static_assert (try_cast<option<int>> (nothing ()).get ().is_nothing ());
+    static_assert (try_cast<just<int>> (nothing ()).is_nothing ());
+
+    maybe<int, std::string> empty;
+    CHECK (try_cast<variant<int, std::string>> (empty).is_nothing ());
+    maybe<int, std::string> full (std::string ("movar"));
+    CHECK (try_cast<variant<int, std::string>> (std::move (full)).get ().get<std::string> () == "movar");
+  }
+
+  SUBCASE ("unchecked")
+  {
+    static_assert (variant<int, double> (1.5).get_unchecked<1> () == 1.5);
+    static_assert (variant<int, double> (1.5).get_unchecked<double> () == 1.5);
+    static_assert (maybe<int, double> (1).get_unchecked<0> () == 1);
+    static_assert (either<int, double> (1).get_unchecked<int> () == 1);
+    static_assert (option (1).get_unchecked<0> () == 1);
+    static_assert (just (1).get_unchecked<0> () == 1);
+  }
+
+  SUBCASE ("checked")
+  {
+    static_assert (noexcept (std::declval<variant<int, double>&> ().get_unchecked<0> ()));
+    static_assert (noexcept (std::declval<variant<int, double>&> ().get<0> ()) == !ML_MOVAR_THROWING_ACCESS);
+    static_assert (noexcept (std::declval<option<int>&> ().get<0> ()) == !ML_MOVAR_THROWING_ACCESS);
+    static_assert (noexcept (std::declval<just<int>&> ().get<0> ()));
+
+#if ML_MOVAR_THROWING_ACCESS
+    variant<int, double> v (1);
+    CHECK_THROWS (v.get<double> ());
+    CHECK_THROWS (v.get<1> ());
+    CHECK_NOTHROW (v.get<int> ());
+    CHECK_THROWS (option<int> ().get ());
+    CHECK_THROWS (maybe<int, double> ().get<0> ());
+    CHECK_THROWS (either<int, double> (1).get<double> ());
+#endif
+  }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE ("canonical")
+{
+  using namespace ml::movar;
+  using ml::internal::movar::first_of;
+  using ml::internal::movar::join;
+  using ml::internal::movar::sort_by_type_key;
+  using ml::internal::movar::type_key;
+  using boost::mp11::mp_list;
+
+  SUBCASE ("type key")
+  {
+    static_assert (type_key<int> () == type_key<int> ());
+    static_assert (type_key<int> () != type_key<long> ());
+    static_assert (type_key<int> () != type_key<int const> ());
+
+    using sorted = sort_by_type_key<mp_list<double, int, std::string, char>>;
+    static_assert (std::same_as<sort_by_type_key<mp_list<char, std::string, int, double>>, sorted>);
+    static_assert (std::same_as<sort_by_type_key<mp_list<int, char, double, std::string>>, sorted>);
+    static_assert (std::same_as<sort_by_type_key<sorted>, sorted>);
+  }
+
+  SUBCASE ("join")
+  {
+    using ab = join<either<int, double>, either<double, int>>;
+    using ba = join<either<double, int>, either<int, double>>;
+    using abc = join<either<int, double>, just<char>, option<long>>;
+
+#if ML_MOVAR_CANONICAL_ORDER
+    using cba = join<option<long>, just<char>, either<double, int>>;
+    static_assert (std::same_as<ab, ba>);
+    static_assert (std::same_as<abc, cba>);
+    static_assert (std::same_as<first_of<option<int>, just<double>>, first_of<option<double>, just<int>>>);
+#else
+    static_assert (std::same_as<ab, either<int, double>>);
+    static_assert (std::same_as<ba, either<double, int>>);
+    static_assert (std::same_as<abc, maybe<int, double, char, long>>);
+    static_assert (std::same_as<first_of<option<int>, just<double>>, either<int, double>>);
+#endif
+  }
+
+  SUBCASE ("values")
+  {
+    auto const a = either<int, double> (1).map ([] (auto x) -> either<double, int> { return x; });
+    auto const b = either<double, int> (2.5).map ([] (auto x) -> either<int, double> { return x; });
+    CHECK (a.get<int> () == 1);
+    CHECK (b.get<double> () == 2.5);
+#if ML_MOVAR_CANONICAL_ORDER
+    static_assert (std::same_as<decltype (a), decltype (b)>);
+#endif
+  }
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+namespace emplace_test
+{
+  // A payload whose constructor throws for negative values.
+  struct boom
+  {
+    std::string text;
+
+    explicit boom (int v)
+      : text (std::to_string (v))
+    {
+#if ML_MOVAR_HAS_EXCEPTIONS
+      if (v < 0)
+        throw v;
+#endif
+    }
+  };
+
+  // A payload that can throw both when constructed and when moved.
+  struct fragile
+  {
+    explicit fragile (int);
+    fragile (fragile&&) noexcept (false);
+  };
+
+  template<class Var, class T>
+  concept can_emplace = requires (Var v) { v.template emplace<T> (1); };
+} // namespace emplace_test
+
+TEST_CASE ("emplace")
+{
+  using namespace ml::movar;
+  using testing::counted;
+
+  SUBCASE ("in place type")
+  {
+    static_assert (variant<int, double, char> (std::in_place_type<double>, 2.5).get<1> () == 2.5);
+    static_assert (maybe<int, double> (std::in_place_type<double>, 2.5).get<double> () == 2.5);
+    static_assert (either<int, double> (std::in_place_type<int>, 3).index () == 0);
+    static_assert (option<int> (std::in_place_type<int>, 3).get () == 3);
+    static_assert (just<int> (std::in_place_type<int>, 3).get () == 3);
+
+    CHECK (variant<int, std::string> (std::in_place_type<std::string>, 3u, 'x').get<1> () == "xxx");
+  }
+
+  SUBCASE ("emplace")
+  {
+    variant<int, std::string, double> v;
+    CHECK (v.emplace<std::string> (2u, 'a') == "aa");
+    CHECK (v.is<std::string> ());
+    CHECK (v.emplace<2> (1.5) == 1.5);
+    CHECK (v.index () == 2);
+
+    maybe<int, std::string> m;
+    m.emplace<1> ("movar");
+    CHECK (m.get<std::string> () == "movar");
+    m.emplace<int> (4);
+    CHECK (m.get<0> () == 4);
+
+    either<int, std::string> e (1);
+    e.emplace<std::string> ("x");
+    CHECK (e.get<1> () == "x");
+
+    option<std::string> o;
+    CHECK (o.emplace<0> (3u, 'b') == "bbb");
+    CHECK (o.is_something ());
+
+    just<std::string> j ("a");
+    CHECK (j.emplace<std::string> ("b") == "b");
+    CHECK (j.get () == "b");
+  }
+
+  SUBCASE ("throwing constructor")
+  {
+    using emplace_test::boom;
+    using emplace_test::fragile;
+
+    // no state would survive a throwing move after a throwing constructor
+    static_assert (!emplace_test::can_emplace<variant<int, fragile>, fragile>);
+    static_assert (!emplace_test::can_emplace<maybe<int, fragile>, fragile>);
+    static_assert (emplace_test::can_emplace<variant<int, boom>, boom>);
+
+    variant<std::string, boom> v (std::string ("kept"));
+    maybe<std::string, boom> m (std::string ("kept"));
+    either<std::string, boom> e (std::string ("kept"));
+    CHECK (v.emplace<boom> (1).text == "1");
+    CHECK (m.emplace<1> (2).text == "2");
+    CHECK (e.emplace<boom> (3).text == "3");
+
+#if ML_MOVAR_HAS_EXCEPTIONS
+    v.emplace<0> ("kept");
+    m.emplace<0> ("kept");
+    e.emplace<0> ("kept");
+    CHECK_THROWS (v.emplace<boom> (-1));
+    CHECK_THROWS (m.emplace<1> (-1));
+    CHECK_THROWS (e.emplace<boom> (-1));
+    CHECK (v.index () == 0);
+    CHECK (v.get<0> () == "kept");
+    CHECK (m.index () == 0);
+    CHECK (m.get<0> () == "kept");
+    CHECK (e.index () == 0);
+    CHECK (e.get<0> () == "kept");
+#endif
+  }
+
+  SUBCASE ("no intermediate moves")
+  {
+    counted::reset ();
+    variant<int, counted> v (std::in_place_type<counted>, 1, 2);
+    maybe<int, counted> m (std::in_place_index<1>, 3);
+    v.emplace<counted> (4);
+    m.emplace<1> (5, 6);
+    just<counted> j (std::in_place_index<0>, 7);
+    j.emplace<0> (8);
+    CHECK (counted::copies == 0);
+    CHECK (counted::moves == 0);
+  }
+
+  SUBCASE ("pipelines")
+  {
+    // the mapped value is constructed directly in the result
+    counted::reset ();
+    auto const mapped = variant<int, double, char> (1).map ([] (auto) { return counted (1); });
+    CHECK (mapped.get ().value == 1);
+    CHECK (counted::moves == 1);
+    CHECK (counted::copies == 0);
+
+    counted::reset ();
+    auto const either_mapped = either<int, counted> (1).map ([] (auto const& x) -> either<int, counted> {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype (x)>, int>)
+        return counted (x);
+      else
+        return x.value;
+    });
+    CHECK (either_mapped.get<counted> ().value == 1);
+    CHECK (counted::copies == 0);
+
+    counted::reset ();
+    auto const defaulted = option<int> ().or_else ([] { return counted (2); });
+    CHECK (defaulted.get<counted> ().value == 2);
+    CHECK (counted::moves == 1);
+    CHECK (counted::copies == 0);
+
+    counted::reset ();
+    counted const fallback (3);
+    auto const with_default = option<int> ().map_or ([] (int) { return counted (0); }, fallback);
+    CHECK (with_default.get ().value == 3);
+    CHECK (counted::copies == 1);
+    CHECK (counted::moves == 1);
+  }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE ("rvalue")
+{
+  using namespace ml::movar;
+  using testing::counted;
+
+  SUBCASE ("getters")
+  {
+    static_assert (std::same_as<decltype (std::declval<variant<int, double>> ().get<0> ()), int&&>);
+    static_assert (std::same_as<decltype (std::declval<variant<int, double>> ().get<double> ()), double&&>);
+    static_assert (std::same_as<decltype (std::declval<maybe<int, double>> ().get<1> ()), double&&>);
+    static_assert (std::same_as<decltype (std::declval<either<int, double>> ().get<int> ()), int&&>);
+    static_assert (std::same_as<decltype (std::declval<option<int>> ().get ()), int&&>);
+    static_assert (std::same_as<decltype (std::declval<just<int>> ().get ()), int&&>);
+    static_assert (std::same_as<decltype (std::declval<variant<int, double>> ().get_unchecked<0> ()), int&&>);
+    static_assert (noexcept (std::declval<variant<std::string, int>> ().get_unchecked<0> ()));
+    static_assert (noexcept (std::declval<just<std::string>> ().get ()));
+
+    static_assert (std::same_as<decltype (std::declval<variant<int, double>> ().extract<0> ()), int>);
+    static_assert (std::same_as<decltype (std::declval<option<int>> ().extract ()), int>);
+    static_assert (std::same_as<decltype (std::declval<just<int>> ().extract ()), int>);
+    static_assert (variant<int, double> (2.5).extract<double> () == 2.5);
+
+    auto&& owned = variant<std::string, int> (std::string ("movar")).extract<0> ();
+    CHECK (owned == "movar");
+  }
+
+  SUBCASE ("moves")
+  {
+    variant<int, counted> v (std::in_place_type<counted>, 1);
+    counted::reset ();
+    counted&& ref = std::move (v).get<counted> ();
+    CHECK (ref.value == 1);
+    CHECK (counted::moves == 0);
+
+    counted const out = std::move (v).extract<1> ();
+    CHECK (out.value == 1);
+    CHECK (counted::moves == 1);
+  }
+
+  SUBCASE ("visit")
+  {
+    // the alternative is moved once, into the parameter of the visitor
+    variant<int, counted> v (std::in_place_type<counted>, 2);
+    counted::reset ();
+    auto const result = std::move (v).map ([] (auto x) {
+      if constexpr (std::same_as<decltype (x), counted>)
+        return x.value;
+      else
+        return x;
+    });
+    CHECK (result.get () == 2);
+    CHECK (counted::moves == 1);
+
+    maybe<int, counted> m (std::in_place_type<counted>, 3);
+    counted::reset ();
+    auto const forwarded = std::move (m).map ([] (auto&& x) -> int {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype (x)>, counted>) {
+        static_assert (std::is_rvalue_reference_v<decltype (x)>);
+        return x.value;
+      } else {
+        return x;
+      }
+    });
+    CHECK (forwarded.get () == 3);
+    CHECK (counted::moves == 0);
+
+    option<counted> o (std::in_place_index<0>, 4);
+    counted::reset ();
+    auto const cast = try_cast<just<counted>> (std::move (o));
+    CHECK (cast.get ().get ().value == 4);
+    CHECK (counted::moves == 2);
+  }
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <cstdint>
+#include <string>
+
+namespace view_test
+{
+  constexpr int twice (int x)
+  {
+    return x * 2;
+  }
+} // namespace view_test
+
+TEST_CASE ("view")
+{
+  using namespace ml::movar;
+  using ml::internal::movar::alternatives;
+  using ml::internal::movar::size;
+  using testing::counted;
+  using boost::mp11::mp_list;
+
+  SUBCASE ("machinery")
+  {
+    static_assert (Some<variant_ref<int, double>>);
+    static_assert (Maybe<maybe_ref<int, double>>);
+    static_assert (std::same_as<alternatives<variant_ref<int, double const>>, mp_list<int&, double const&>>);
+    static_assert (size<maybe_ref<int, double, char>> == 3);
+    static_assert (std::is_trivially_copyable_v<variant_ref<int, std::string>>);
+    static_assert (std::is_trivially_copyable_v<maybe_ref<int, std::string>>);
+  }
+
+  SUBCASE ("construction")
+  {
+    variant<int, std::string> owner (std::string ("movar"));
+    variant_ref ref (owner);
+    static_assert (std::same_as<decltype (ref), variant_ref<int, std::string>>);
+    CHECK (ref.index () == 1);
+    CHECK (&ref.get<std::string> () == &owner.get<1> ());
+
+    variant<int, std::string> const& const_owner = owner;
+    variant_ref const_ref (const_owner);
+    static_assert (std::same_as<decltype (const_ref), variant_ref<int const, std::string const>>);
+    CHECK (const_ref.get<1> () == "movar");
+
+    int x = 10;
+    variant_ref<int, std::string> int_ref (x);
+    int_ref.get<int> () = 11;
+    CHECK (x == 11);
+
+    maybe<int, std::string> empty;
+    maybe_ref empty_ref (empty);
+    CHECK (empty_ref.is_nothing ());
+    CHECK (empty_ref.index () == -1);
+
+    maybe_ref<int, std::string> from_ref (ref);
+    CHECK (from_ref.is<std::string> ());
+    CHECK (maybe_ref<int, std::string> ().is_nothing ());
+  }
+
+  SUBCASE ("erased")
+  {
+    // tag and payload stored separately, e.g. in a decoded buffer
+    std::uint8_t const tags[] = {1, 0};
+    double const doubles[] = {2.5};
+    int const ints[] = {7};
+    void const* payloads[] = {&doubles[0], &ints[0]};
+
+    variant_ref<int const, double const> first (tags[0], payloads[0]);
+    variant_ref<int const, double const> second (tags[1], payloads[1]);
+    CHECK (first.get<double const> () == 2.5);
+    CHECK (second.get<0> () == 7);
+
+    maybe_ref<int const, double const> none (-1, nullptr);
+    CHECK (none.is_nothing ());
+  }
+
+  SUBCASE ("visit")
+  {
+    variant<counted, int> owner (std::in_place_index<0>, 4);
+    counted::reset ();
+
+    variant_ref ref (owner);
+    auto const doubled = ref.map ([] (auto& x) {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype (x)>, counted>)
+        return view_test::twice (x.value);
+      else
+        return view_test::twice (x);
+    });
+    CHECK (doubled.get () == 8);
+
+    // visitors receive the referenced object, even through a const view
+    variant_ref<counted, int> const cref (owner);
+    std::move (cref).match ([] (auto& x) {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype (x)>, counted>)
+        x.value = 5;
+    });
+    CHECK (owner.get<0> ().value == 5);
+    CHECK (counted::copies == 0);
+
+    maybe_ref<counted, int> const empty;
+    CHECK (empty.map_or ([] (auto&) { return 1; }, 2).get () == 2);
+    CHECK (empty.match ([] (auto&& x) { return None<std::remove_cvref_t<decltype (x)>> ? 2 : 1; }).get () == 2);
+  }
+
+  SUBCASE ("pipelines")
+  {
+    int x = 3;
+    variant_ref<int, double> ref (x);
+    auto pipe = sequence () >> filter ([] (auto const& v) { return v > 0; }) >> [] (auto v) { return v + 1; };
+    CHECK (pipe (ref).get<int> () == 4);
+
+    variant<int, double> owned (ref);
+    CHECK (owned.get<int> () == 3);
+  }
+}
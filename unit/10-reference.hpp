@@ -0,0 +1,95 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <map>
+#include <string>
+
+namespace reference_test
+{
+  // A table row, whose copies are counted by its score.
+  struct row
+  {
+    std::string name;
+    testing::counted score;
+  };
+
+  // A lookup stage returning a reference into the table, or nothing
+  inline ml::movar::option<row&> lookup (std::map<int, row>& table, int key)
+  {
+    auto const it = table.find (key);
+    if (it == table.end ())
+      return ml::movar::nothing ();
+    return it->second;
+  }
+} // namespace reference_test
+
+TEST_CASE ("reference")
+{
+  using namespace ml::movar;
+  using ml::internal::movar::alternatives;
+  using reference_test::row;
+  using testing::counted;
+  using boost::mp11::mp_list;
+
+  SUBCASE ("machinery")
+  {
+    static_assert (Maybe<option<int&>>);
+    static_assert (Some<either<int&, double const&>>);
+    static_assert (std::same_as<alternatives<maybe<int&, double const&>>, mp_list<int&, double const&>>);
+    static_assert (sizeof (option<std::string&>) <= 2 * sizeof (void*));
+    static_assert (std::is_trivially_copyable_v<maybe<std::string&, int&>>);
+  }
+
+  SUBCASE ("access")
+  {
+    int x = 1;
+    option<int&> ref (x);
+    ref.get () = 2;
+    CHECK (x == 2);
+    CHECK (&ref.get () == &x);
+    CHECK (option<int&> ().is_nothing ());
+
+    double d = 1.5;
+    maybe<int&, double&> m (d);
+    CHECK (m.index () == 1);
+    CHECK (m.get<double> () == 1.5);
+
+    just<int&> j (x);
+    CHECK (j.get () == 2);
+
+    // materialize into an owning option
+    option<int> copy (ref);
+    CHECK (copy.get () == 2);
+  }
+
+  SUBCASE ("lookup")
+  {
+    std::map<int, row> table;
+    table.emplace (1, row {"a", counted (10)});
+    table.emplace (2, row {"b", counted (20)});
+    counted::reset ();
+
+    auto const found = reference_test::lookup (table, 2);
+    auto const score = found.map ([] (row& r) { return r.score.value; });
+    static_assert (std::same_as<decltype (score), option<int> const>);
+    CHECK (score.get () == 20);
+
+    reference_test::lookup (table, 1).match ([] (auto&& r) {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype (r)>, row>)
+        r.score.value += 1;
+    });
+    CHECK (table.at (1).score.value == 11);
+
+    auto const missing = reference_test::lookup (table, 3) //
+      .map_or ([] (row const& r) { return r.score.value; }, -1);
+    CHECK (missing.get () == -1);
+    CHECK (counted::copies == 0);
+
+    // a pipeline stage returning a reference alternative passes it straight to the next stage
+    auto pipe = sequence () >> [&table] (int key) { return reference_test::lookup (table, key); }
+      >> [] (row& r) -> std::string const& { return r.name; };
+    CHECK (pipe (2).get () == "b");
+    CHECK (pipe (5).is_nothing ());
+  }
+}
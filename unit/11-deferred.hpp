@@ -0,0 +1,75 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+
+namespace deferred_test
+{
+  inline constexpr auto add1 = [] (auto x) { return x + 1; };
+  inline constexpr auto twice = [] (auto x) { return x * 2; };
+  inline constexpr auto to_long = [] (auto x) { return static_cast<long> (x); };
+  inline constexpr auto positive = [] (auto x) -> ml::movar::option<decltype (x)> {
+    if (x > 0)
+      return x;
+    return ml::movar::nothing ();
+  };
+  inline constexpr auto split = [] (int x) -> ml::movar::either<int, double> {
+    if (x % 2 == 0)
+      return x;
+    return x / 2.0;
+  };
+} // namespace deferred_test
+
+TEST_CASE ("deferred")
+{
+  using namespace ml::movar;
+  using namespace deferred_test;
+  using testing::counted;
+
+  SUBCASE ("same result as chained maps")
+  {
+    constexpr variant<int, double, char> v (2.5);
+    constexpr auto chained = v.map (add1).map (twice).map (to_long);
+    constexpr auto deferred = v.lazy_map (add1).map (twice).map (to_long).eval ();
+    static_assert (std::same_as<decltype (chained), decltype (deferred)>);
+    static_assert (chained == deferred);
+    static_assert (deferred.get () == 7);
+
+    constexpr maybe<int, double> m (3);
+    static_assert (std::same_as<decltype (m.map (positive).map (add1)), decltype (m.lazy_map (positive).map (add1).eval ())>);
+    static_assert (m.lazy_map (positive).map (add1).eval () == m.map (positive).map (add1));
+    static_assert (maybe<int, double> ().lazy_map (add1).map (twice).eval ().is_nothing ());
+
+    constexpr just<int> j (3);
+    static_assert (std::same_as<decltype (j.map (split).map (add1)), decltype (j.lazy_map (split).map (add1).eval ())>);
+    static_assert (j.lazy_map (split).map (add1).eval () == j.map (split).map (add1));
+    static_assert (option (-1).lazy_map (positive).map (add1).eval ().is_nothing ());
+  }
+
+  SUBCASE ("single visit")
+  {
+    // Every eager map stores its result in a new variant and visits it again, moving the payload into it.
+    // The deferred chain visits the source once and stores only the final result.
+    auto const make = [] (int x) { return counted (x); };
+    auto const next = [] (counted const& c) { return counted (c.value + 1); };
+    auto const read = [] (counted const& c) { return c.value; };
+
+    variant<int, long> const v (1);
+    counted::reset ();
+    auto const eager = v.map (make).map (next).map (next);
+    int const eager_moves = counted::moves;
+    counted::reset ();
+    auto const lazy = v.lazy_map (make).map (next).map (next).eval ();
+    int const lazy_moves = counted::moves;
+    CHECK (eager.get ().value == 3);
+    CHECK (lazy.get ().value == 3);
+    CHECK (eager_moves == 3);
+    CHECK (lazy_moves == 1);
+    CHECK (eager_moves > lazy_moves);
+
+    // the intermediate results are passed between functions without being stored in a variant
+    counted::reset ();
+    CHECK (just (5).lazy_map (make).map (read).eval ().get () == 5);
+    CHECK (counted::moves == 0);
+  }
+}
\ No newline at end of file
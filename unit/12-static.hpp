@@ -0,0 +1,122 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+namespace static_test
+{
+  struct ping
+  {
+    int id;
+
+    bool operator== (ping const&) const = default;
+  };
+
+  struct pong
+  {
+    int id;
+
+    bool operator== (pong const&) const = default;
+  };
+
+  inline constexpr auto reply = [] (auto msg) { return pong {msg.id + 1}; };
+  inline constexpr auto id = [] (auto msg) -> int { return msg.id; };
+  inline constexpr auto halve = [] (int x) -> ml::movar::either<int, double> {
+    if (x % 2 == 0)
+      return x / 2;
+    return x / 2.0;
+  };
+  inline constexpr auto sink = [] (auto) {};
+} // namespace static_test
+
+TEST_CASE ("static")
+{
+  using namespace ml::movar;
+  using namespace static_test;
+
+  SUBCASE ("construction")
+  {
+    constexpr variant<ping, pong, int> v (pong {3});
+    constexpr static_variant s (known<1>, v);
+    static_assert (std::same_as<decltype (s), static_variant<1, ping, pong, int> const>);
+    static_assert (s.index () == 1);
+    static_assert (s.get ().id == 3);
+
+    constexpr variant<ping, pong, int> back = s;
+    static_assert (back.index () == 1);
+    static_assert (back.get<pong> ().id == 3);
+
+    constexpr maybe<int, double> m (2.5);
+    static_assert (std::same_as<decltype (static_variant (known<1>, m)), static_variant<1, int, double>>);
+    static_assert (static_variant (known<1>, m).get () == 2.5);
+  }
+
+  SUBCASE ("index propagates")
+  {
+    constexpr static_variant<0, ping, pong> s (ping {1});
+    constexpr either<ping, pong> dynamic = s;
+
+    // same result as the dynamic pipeline, with a static index
+    constexpr auto mapped = s.map (reply);
+    static_assert (std::same_as<decltype (mapped), static_variant<0, pong> const>);
+    static_assert (decltype (dynamic.map (reply)) (mapped) == dynamic.map (reply));
+
+    constexpr auto chained = s.map (reply).map (reply).match (id);
+    static_assert (std::same_as<decltype (chained), static_variant<0, int> const>);
+    static_assert (chained.get () == 3);
+    static_assert (decltype (dynamic.map (reply).map (reply).match (id)) (chained) == 3);
+
+    // the index is relative to the alternatives of the dynamic result
+    constexpr static_variant<1, int, double> d (1.5);
+    constexpr auto widened = d.map ([] (auto x) { return static_cast<double> (x); });
+    static_assert (std::same_as<decltype (widened), static_variant<0, double> const>);
+
+    // a Variant result ends the static chain
+    static_assert (std::same_as<decltype (static_variant<0, int> (4).map (halve)), either<int, double>>);
+    static_assert (static_variant<0, int> (4).map (halve).get<int> () == 2);
+
+    // void results are statically empty
+    static_assert (std::same_as<decltype (s.map (sink)), nothing>);
+  }
+
+  SUBCASE ("lazy pipelines")
+  {
+    auto const twice = [] (int x) { return x * 2; };
+    auto const is_even = [] (int x) { return x % 2 == 0; };
+    constexpr static_variant<0, int, double> s (4);
+
+    // the stages receive the active alternative, not the static_variant
+    CHECK ((sequence () >> twice) (s) == just<int> (8));
+    static_variant const known_int (known<0>, variant<int, double> (1));
+    CHECK ((sequence () >> twice >> twice) (known_int) == just<int> (4));
+    CHECK (sequence () (s) == just<int> (4));
+    CHECK (filter (is_even) (s) == option<int> (4));
+    CHECK ((filter (is_even) >> twice) (static_variant<0, int> (3)) == nothing ());
+    CHECK ((filter (is_even) >> filter (is_even)) (s) == option<int> (4));
+    CHECK ((filter ([] (int) { return false; }) | (sequence () >> twice)) (s) == option<int> (8));
+    CHECK (filter_type<int> () (s) == just<int> (4));
+    CHECK (filter_type<double> () (s) == nothing ());
+
+    // same result as the pipeline applied to the alternative of the dynamic variant
+    auto const pipeline = filter (is_even) >> twice;
+    variant<int, double> const dynamic = s;
+    CHECK (pipeline (s) == dynamic.map (pipeline));
+
+    // rvalue static_variants are moved into the first stage
+    auto const length = [] (std::string text) { return text.size (); };
+    CHECK ((sequence () >> length) (static_variant<0, std::string> ("four")) == just<std::size_t> (4));
+  }
+
+  SUBCASE ("or_else")
+  {
+    bool called = false;
+    auto const fallback = [&called] {
+      called = true;
+      return 0.5;
+    };
+    auto const result = static_variant<1, int, long> (2L).or_else (fallback);
+    static_assert (std::same_as<decltype (result), static_variant<1, int, long> const>);
+    CHECK (result.get () == 2L);
+    CHECK (!called);
+  }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+TEST_CASE ("flatten")
+{
+  using namespace ml::movar;
+
+  using nested = variant<char, either<int, double>, option<long>>;
+
+  SUBCASE ("flattened type")
+  {
+#if ML_MOVAR_CANONICAL_ORDER
+    static_assert (Maybe<flatten_t<nested>> && ml::internal::movar::size<flatten_t<nested>> == 4);
+    static_assert (ml::internal::movar::size<flatten_t<variant<int, either<int, double>>>> == 2);
+#else
+    static_assert (std::same_as<flatten_t<nested>, maybe<char, int, double, long>>);
+    static_assert (std::same_as<flatten_t<variant<int, either<int, double>>>, either<int, double>>);
+    static_assert (std::same_as<flatten_t<variant<int, variant<double, just<char>>>>, variant<int, double, char>>);
+    static_assert (std::same_as<flatten_t<either<int, double>>, either<int, double>>);
+#endif
+  }
+
+  SUBCASE ("flatten")
+  {
+    static_assert (flatten (nested ('x')).get<char> () == 'x');
+    static_assert (flatten (nested (either<int, double> (2.5))).get<double> () == 2.5);
+    static_assert (flatten (nested (option<long> (7L))).get<long> () == 7L);
+    static_assert (flatten (nested (option<long> ())).is_nothing ());
+    static_assert (flatten (maybe<int, either<int, double>> (either<int, double> (3))).get<int> () == 3);
+  }
+
+  SUBCASE ("deep_match")
+  {
+    auto const name = [] (auto x) -> char const* {
+      if constexpr (std::same_as<decltype (x), nothing>)
+        return "nothing";
+      else if constexpr (std::same_as<decltype (x), char>)
+        return "char";
+      else if constexpr (std::same_as<decltype (x), int>)
+        return "int";
+      else if constexpr (std::same_as<decltype (x), double>)
+        return "double";
+      else
+        return "long";
+    };
+
+    CHECK (std::string (deep_match (nested ('x'), name).get ()) == "char");
+    CHECK (std::string (deep_match (nested (either<int, double> (1)), name).get ()) == "int");
+    CHECK (std::string (deep_match (nested (either<int, double> (1.)), name).get ()) == "double");
+    CHECK (std::string (deep_match (nested (option<long> (1L)), name).get ()) == "long");
+    CHECK (std::string (deep_match (nested (option<long> ()), name).get ()) == "nothing");
+
+    // the leaves are passed by reference
+    nested v (either<int, double> (1));
+    deep_match (v, [] (auto&& x) {
+      if constexpr (std::same_as<decltype (x), int&>)
+        x = 5;
+    });
+    CHECK (v.get<either<int, double>> ().get<int> () == 5);
+  }
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/movar.hpp>
+#include <doctest/doctest.h>
+#include <string>
+
+namespace accounting_test
+{
+  using testing::counted;
+
+  // Copies, moves and allocations performed by an operation.
+  struct cost
+  {
+    int copies = 0;
+    int moves = 0;
+    long allocations = 0;
+
+    bool operator== (cost const&) const = default;
+  };
+
+  // Runs @a fn on an lvalue prepared by @a setup, counting only what @a fn does.
+  template<class Setup, class Fn>
+  cost measure (Setup setup, Fn fn)
+  {
+    auto arg = setup ();
+    counted::reset ();
+    long const before = testing::allocations;
+    auto const result = fn (arg);
+    (void) result;
+    return {counted::copies, counted::moves, testing::allocations - before};
+  }
+
+  // Reads the payload without copying.
+  struct value_of
+  {
+    int operator() (counted const& t) const
+    {
+      return t.value;
+    }
+
+    int operator() (int x) const
+    {
+      return x;
+    }
+
+    int operator() (std::string const& s) const
+    {
+      return static_cast<int> (s.size ());
+    }
+
+    int operator() (ml::movar::nothing) const
+    {
+      return 0;
+    }
+  };
+
+  // Returns its argument, forwarding rvalues.
+  inline constexpr auto forward = [] (auto&& x) -> std::remove_cvref_t<decltype (x)> {
+    return std::forward<decltype (x)> (x);
+  };
+} // namespace accounting_test
+
+TEST_CASE ("accounting")
+{
+  using namespace ml::movar;
+  using namespace accounting_test;
+
+  using var = variant<counted, int>;
+  using opt = option<counted>;
+  using may = maybe<counted, int>;
+
+  auto const some = [] { return var (counted (1)); };
+  auto const some_opt = [] { return opt (counted (1)); };
+  auto const empty_opt = [] { return opt (); };
+  auto const some_may = [] { return may (counted (1)); };
+  auto const yes = [] (auto const&) { return true; };
+  auto const no = [] (auto const&) { return false; };
+
+  // Budgets are {copies, moves} of the counted alternative and the allocations of the operation. Visiting
+  // by reference is free, a function returning by value costs one copy or move to produce the value and
+  // one move to store it.
+
+  SUBCASE ("map and match")
+  {
+    CHECK (measure (some, [] (var& v) { return v.map (value_of {}); }) == cost {0, 0, 0});
+    CHECK (measure (some, [] (var& v) { return v.map (forward); }) == cost {1, 1, 0});
+    CHECK (measure (some, [] (var& v) { return std::move (v).map (forward); }) == cost {0, 2, 0});
+    CHECK (measure (some_may, [] (may& v) { return v.match (value_of {}); }) == cost {0, 0, 0});
+    CHECK (measure (some_may, [] (may& v) { return std::move (v).match (forward); }) == cost {0, 2, 0});
+  }
+
+  SUBCASE ("or_else and map_or_else")
+  {
+    auto const zero = [] { return 0; };
+    auto const make = [] { return counted (0); };
+    CHECK (measure (some_opt, [zero] (opt& v) { return v.or_else (zero); }) == cost {1, 0, 0});
+    CHECK (measure (some_opt, [zero] (opt& v) { return std::move (v).or_else (zero); }) == cost {0, 1, 0});
+    CHECK (measure (empty_opt, [make] (opt& v) { return std::move (v).or_else (make); }) == cost {0, 1, 0});
+    CHECK (measure (some_opt, [zero] (opt& v) { return v.map_or_else (value_of {}, zero); }) == cost {0, 0, 0});
+    CHECK (measure (some_opt, [make] (opt& v) { return std::move (v).map_or_else (forward, make); }) == cost {0, 2, 0});
+    CHECK (measure (empty_opt, [make] (opt& v) { return std::move (v).map_or_else (forward, make); }) == cost {0, 1, 0});
+  }
+
+  SUBCASE ("take")
+  {
+    CHECK (measure (some_may, [] (may& v) { return std::move (v).take (); }) == cost {0, 1, 0});
+    CHECK (measure (some_opt, [] (opt& v) { return std::move (v).take (); }) == cost {0, 1, 0});
+  }
+
+  SUBCASE ("casts")
+  {
+    auto const some_just = [] { return just<counted> (counted (1)); };
+    auto const some_either = [] { return either<counted, int> (counted (1)); };
+    CHECK (measure (some_just, [] (just<counted>& v) { return opt (v); }) == cost {1, 0, 0});
+    CHECK (measure (some_just, [] (just<counted>& v) { return opt (std::move (v)); }) == cost {0, 1, 0});
+    CHECK (measure (some_either, [] (either<counted, int>& v) {
+      variant<int, counted, char> result = std::move (v);
+      return result;
+    }) == cost {0, 1, 0});
+    CHECK (measure (some_may, [] (may& v) { return var (v); }) == cost {1, 0, 0});
+    CHECK (measure (some_may, [] (may& v) { return var (std::move (v)); }) == cost {0, 1, 0});
+  }
+
+  SUBCASE ("heap payloads")
+  {
+    // copying a string longer than the small-string buffer allocates, moving it does not
+    using text = variant<std::string, int>;
+    using opt_text = option<std::string>;
+    auto const long_text = [] { return text (std::string (64, 'x')); };
+    auto const long_opt = [] { return opt_text (std::string (64, 'x')); };
+    auto const empty_text = [] { return std::string (); };
+    CHECK (measure (long_text, [] (text& v) { return v.map (value_of {}); }) == cost {0, 0, 0});
+    CHECK (measure (long_text, [] (text& v) { return v.map (forward); }) == cost {0, 0, 1});
+    CHECK (measure (long_text, [] (text& v) { return std::move (v).map (forward); }) == cost {0, 0, 0});
+    CHECK (measure (long_text, [] (text& v) { return text (v); }) == cost {0, 0, 1});
+    CHECK (measure (long_text, [] (text& v) { return v.map (sequence () >> forward >> forward); })
+      == cost {0, 0, 1});
+    CHECK (measure (long_opt, [empty_text] (opt_text& v) { return v.or_else (empty_text); })
+      == cost {0, 0, 1});
+    CHECK (measure (long_opt, [] (opt_text& v) { return std::move (v).take (); }) == cost {0, 0, 0});
+    CHECK (measure (long_opt, [] (opt_text& v) { return just<std::string> (v.get ()); }) == cost {0, 0, 1});
+  }
+
+  SUBCASE ("lazy pipelines")
+  {
+    CHECK (measure (some, [] (var& v) { return v.map (sequence () >> value_of {}); }) == cost {0, 0, 0});
+    CHECK (measure (some, [] (var& v) { return std::move (v).map (sequence () >> forward >> forward); })
+      == cost {0, 4, 0});
+    CHECK (measure (some, [yes] (var& v) { return v.map (filter (yes) >> value_of {}); }) == cost {1, 0, 0});
+    CHECK (measure (some, [yes] (var& v) { return std::move (v).map (filter (yes) >> forward); }) == cost {0, 4, 0});
+    CHECK (measure (some, [no] (var& v) { return v.map (filter (no) | (sequence () >> value_of {})); })
+      == cost {0, 0, 0});
+    CHECK (measure (some, [no] (var& v) { return std::move (v).map (filter (no) | (sequence () >> forward)); })
+      == cost {0, 3, 0});
+  }
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+#include <ml/movar/container.hpp>
+#include <doctest/doctest.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hash_test
+{
+  // A value whose move may throw, so that a rehash copies it; the copy throws once the budget is spent.
+  struct brittle
+  {
+    static inline int copies_left = -1;
+
+    std::string text;
+
+    explicit brittle (int v)
+      : text (std::string (32, 'x') + std::to_string (v))
+    {}
+
+    brittle (brittle const& other)
+      : text (other.text)
+    {
+#if ML_MOVAR_HAS_EXCEPTIONS
+      if (copies_left == 0)
+        throw copies_left;
+#endif
+      if (copies_left > 0)
+        --copies_left;
+    }
+
+    brittle (brittle&& other) noexcept (false)
+      : text (std::move (other.text))
+    {}
+  };
+} // namespace hash_test
+
+TEST_CASE ("hash")
+{
+  using namespace ml::movar;
+
+  using key = variant<int, std::string>;
+
+  SUBCASE ("std::hash")
+  {
+    std::hash<key> const hash;
+    CHECK (hash (key (1)) == hash (key (1)));
+    CHECK (hash (key (std::string ("a"))) == hash (key (std::string ("a"))));
+    CHECK (hash (key (1)) != hash (key (2)));
+    CHECK (std::hash<either<int, unsigned>> {}(1) != std::hash<either<int, unsigned>> {}(1u));
+    CHECK (std::hash<maybe<int, char>> {}(maybe<int, char> ()) == std::hash<nothing> {}(nothing ()));
+    CHECK (std::hash<option<int>> {}(option<int> (3)) == std::hash<just<int>> {}(just<int> (3)));
+
+    std::unordered_set<option<int>> set {option<int> (1), option<int> (), option<int> (1)};
+    CHECK (set.size () == 2);
+
+    struct opaque
+    {};
+    static_assert (!std::is_default_constructible_v<std::hash<variant<int, opaque>>>);
+  }
+
+  SUBCASE ("transparent lookup")
+  {
+    variant_hash<key> const hash;
+    CHECK (hash (1) == hash (key (1)));
+    CHECK (hash (std::string ("a")) == hash (key (std::string ("a"))));
+
+    std::unordered_map<key, int, variant_hash<key>, variant_equal<key>> map;
+    map[key (std::string ("a"))] = 1;
+    map[key (2)] = 2;
+    CHECK (map.find (std::string ("a"))->second == 1);
+    CHECK (map.find (2)->second == 2);
+    CHECK (map.find (3) == map.end ());
+  }
+
+  SUBCASE ("variant_map")
+  {
+    variant_map<key, int> map;
+    CHECK (map.empty ());
+    CHECK (map.find (1) == map.end ());
+
+    for (int i = 0; i < 1000; ++i)
+      CHECK (map.try_emplace (i, i * 2).second);
+    map[std::string ("a")] = -1;
+    CHECK (!map.try_emplace (5, 0).second);
+    CHECK (map.size () == 1001);
+    CHECK (map.capacity () >= 1001);
+
+    CHECK (map.find (5)->second == 10);
+    CHECK (map.find (key (999))->second == 1998);
+    CHECK (map.find (std::string ("a"))->second == -1);
+    CHECK (!map.contains (std::string ("b")));
+    CHECK (!map.contains (1000));
+
+    for (int i = 0; i < 1000; i += 2)
+      CHECK (map.erase (i) == 1);
+    CHECK (map.erase (0) == 0);
+    CHECK (map.size () == 501);
+
+    long sum = 0;
+    for (auto const& [k, v] : map)
+      sum += v;
+    CHECK (sum == 500 * 1000 - 1);
+
+    for (int i = 0; i < 1000; ++i)
+      CHECK (map.contains (i) == (i % 2 == 1));
+
+    auto copy = map;
+    map.erase (map.find (1));
+    CHECK (copy.contains (1));
+    CHECK (!map.contains (1));
+
+    auto moved = std::move (copy);
+    CHECK (moved.size () == 501);
+
+    map.clear ();
+    CHECK (map.empty ());
+    CHECK (map.find (3) == map.end ());
+  }
+  SUBCASE ("throwing rehash")
+  {
+    using hash_test::brittle;
+
+    // 14 entries fill the initial 16 slots, the next insertion rehashes
+    variant_map<key, brittle> map;
+    for (int i = 0; i < 14; ++i)
+      map.try_emplace (i, i);
+    REQUIRE (map.capacity () == 16);
+
+#if ML_MOVAR_HAS_EXCEPTIONS
+    brittle::copies_left = 3;
+    CHECK_THROWS (map.try_emplace (14, 14));
+    brittle::copies_left = -1;
+    CHECK (map.size () == 14);
+    CHECK (map.capacity () == 16);
+    for (int i = 0; i < 14; ++i)
+      CHECK (map.find (i)->second.text == brittle (i).text);
+#endif
+
+    map.try_emplace (14, 14);
+    CHECK (map.size () == 15);
+    CHECK (map.capacity () == 32);
+    for (int i = 0; i < 15; ++i)
+      CHECK (map.find (i)->second.text == brittle (i).text);
+  }
+  SUBCASE ("throwing insertion")
+  {
+#if ML_MOVAR_HAS_EXCEPTIONS
+    using hash_test::brittle;
+
+    // Failed insertions into erased slots must leave them counted, or the table fills up with erased
+    // slots without rehashing and probes forever.
+    variant_map<key, brittle> map;
+    brittle const value (0);
+    for (int i = 0; i < 2000; ++i) {
+      map.try_emplace (i, i);
+      if (i >= 12)
+        map.erase (i - 12);
+      brittle::copies_left = 0;
+      CHECK_THROWS (map.try_emplace (-i - 1, value));
+      brittle::copies_left = -1;
+    }
+    CHECK (map.size () == 12);
+    CHECK (!map.contains (-1));
+#endif
+  }
+}
\ No newline at end of file
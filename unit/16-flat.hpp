@@ -0,0 +1,98 @@
+#pragma once
+#include <ml/movar/container.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST_CASE ("flat")
+{
+  using namespace ml::movar;
+
+  using key = maybe<int, std::string>;
+
+  SUBCASE ("index_first_less")
+  {
+    constexpr index_first_less<variant<int, char>> less;
+    static_assert (less (variant<int, char> (5), variant<int, char> ('a')));
+    static_assert (!less (variant<int, char> ('a'), variant<int, char> (5)));
+    static_assert (less (variant<int, char> (1), variant<int, char> (2)));
+    static_assert (less (1, variant<int, char> (2)));
+    static_assert (!less (variant<int, char> ('b'), 'a'));
+
+    std::vector<key> values {key (3), key (std::string ("b")), key (), key (1), key (std::string ("a")), key (2)};
+    auto sorted = values;
+    std::ranges::sort (sorted, index_first_less<key> {});
+    CHECK (std::ranges::is_sorted (sorted));
+    CHECK (sorted.front ().is_nothing ());
+  }
+
+  SUBCASE ("flat_variant_set")
+  {
+    flat_variant_set<key> set {key (3), key (std::string ("b")), key (1), key (3)};
+    CHECK (set.size () == 3);
+    CHECK (set.segment<int> ().size () == 2);
+    CHECK (set.segment<std::string> ().size () == 1);
+    CHECK (set.segment<nothing> ().empty ());
+
+    CHECK (set.insert (key ()).second);
+    CHECK (set.insert (key (2)).second);
+    CHECK (!set.insert (key (2)).second);
+    CHECK (set.insert (key (std::string ("a"))).second);
+    CHECK (set.size () == 6);
+    CHECK (std::ranges::is_sorted (set));
+
+    CHECK (set.contains (2));
+    CHECK (set.contains (key ()));
+    CHECK (set.contains (nothing ()));
+    CHECK (set.contains (std::string ("a")));
+    CHECK (!set.contains (4));
+    CHECK (set.count (key (3)) == 1);
+
+    auto const ints = set.segment<0> ();
+    CHECK (ints.size () == 3);
+    CHECK (ints.front () == key (1));
+    CHECK (ints.back () == key (3));
+    CHECK (set.segment<std::string> ().front () == key (std::string ("a")));
+
+    CHECK (set.lower_bound (2) == set.find (2));
+    CHECK (set.upper_bound (2) == set.find (3));
+    CHECK (set.lower_bound (4) == set.find (std::string ("a")));
+
+    CHECK (set.erase (2) == 1);
+    CHECK (set.erase (2) == 0);
+    set.erase (set.find (nothing ()));
+    CHECK (set.segment<int> ().size () == 2);
+    CHECK (set.segment<nothing> ().empty ());
+    CHECK (set.size () == 4);
+  }
+
+  SUBCASE ("flat_variant_map")
+  {
+    using route = variant<int, std::string>;
+    flat_variant_map<route, int> map {{route (10), 1}, {route (std::string ("x")), 2}};
+
+    CHECK (map.try_emplace (5, 3).second);
+    CHECK (!map.try_emplace (5, 4).second);
+    map[std::string ("a")] = 5;
+    map[route (10)] += 10;
+
+    CHECK (map.size () == 4);
+    CHECK (map.find (5)->second == 3);
+    CHECK (map.find (10)->second == 11);
+    CHECK (map.find (std::string ("x"))->second == 2);
+
+    auto const strings = map.segment<std::string> ();
+    REQUIRE (strings.size () == 2);
+    CHECK (strings[0].first == route (std::string ("a")));
+    CHECK (strings[1].second == 2);
+
+    map.erase (map.find (5));
+    CHECK (map.erase (std::string ("a")) == 1);
+    CHECK (map.segment<int> ().size () == 1);
+    CHECK (map.segment<std::string> ().size () == 1);
+
+    auto const copy = map;
+    CHECK (copy == map);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+#include <ml/movar/container.hpp>
+#include <doctest/doctest.h>
+#include <span>
+#include <string>
+
+namespace collection_test
+{
+  template<class... Fns>
+  struct overloaded : Fns...
+  {
+    using Fns::operator()...;
+  };
+
+  template<class Collection, class Value>
+  concept insertable = requires (Collection collection, Value value) { collection.insert (value); };
+} // namespace collection_test
+
+TEST_CASE ("collection")
+{
+  using collection_test::overloaded;
+  using namespace ml::movar;
+
+  using shape = variant<int, double, std::string>;
+  using collection = variant_collection_for<shape>;
+  static_assert (std::same_as<collection, variant_collection<int, double, std::string>>);
+
+  collection shapes;
+  CHECK (shapes.empty ());
+
+  CHECK (shapes.insert (shape (1)));
+  CHECK (shapes.insert (shape (std::string ("a"))));
+  CHECK (shapes.insert (shape (2.5)));
+  CHECK (shapes.insert (option<int> (2)));
+  CHECK (!shapes.insert (option<int> ()));
+  CHECK (!shapes.insert (nothing ()));
+  CHECK (shapes.insert (either<int, std::string> (std::string ("b"))));
+  shapes.insert (3);
+  shapes.emplace<std::string> (2, 'c');
+
+  static_assert (collection_test::insertable<collection, maybe<int, double>>);
+  static_assert (!collection_test::insertable<collection, maybe<int, char>>);
+
+  CHECK (shapes.size () == 7);
+  CHECK (shapes.size<int> () == 3);
+  CHECK (shapes.size<double> () == 1);
+  CHECK (shapes.size<std::string> () == 3);
+  CHECK (shapes.segment<int> ()[1] == 2);
+  CHECK (shapes.segment<std::string> ()[2] == "cc");
+
+  SUBCASE ("match_each")
+  {
+    int ints = 0;
+    double doubles = 0;
+    std::string strings;
+    shapes.match_each (overloaded {
+      [&] (int x) { ints += x; },
+      [&] (double x) { doubles += x; },
+      [&] (std::string const& x) { strings += x; },
+    });
+    CHECK (ints == 6);
+    CHECK (doubles == 2.5);
+    CHECK (strings == "abcc");
+
+    auto doubled = shapes;
+    doubled.match_each ([] (auto& x) -> void { x = x + x; });
+    CHECK (doubled.segment<int> ()[2] == 6);
+    CHECK (doubled.segment<std::string> ()[0] == "aa");
+  }
+
+  SUBCASE ("erase_if and clear")
+  {
+    CHECK (shapes.erase_if<int> ([] (int x) { return x % 2 == 1; }) == 2);
+    CHECK (shapes.size<int> () == 1);
+
+    auto const copy = shapes;
+    CHECK (copy == shapes);
+
+    shapes.clear ();
+    CHECK (shapes.empty ());
+    CHECK (copy != shapes);
+  }
+  SUBCASE ("bool")
+  {
+    using flags = variant_collection_for<maybe<int, bool>>;
+    static_assert (std::same_as<flags, variant_collection<int, bool>>);
+
+    flags values;
+    CHECK (values.insert (maybe<int, bool> (true)));
+    CHECK (!values.insert (maybe<int, bool> ()));
+    values.insert (1);
+    values.emplace<bool> () = true;
+    values.insert (false);
+    std::span<bool> const segment = values.segment<bool> ();
+    CHECK (segment.size () == 3);
+    CHECK (segment[0]);
+    CHECK (segment[1]);
+    CHECK (!segment[2]);
+
+    CHECK (values.erase_if<bool> ([] (bool x) { return x; }) == 2);
+    CHECK (values.size () == 2);
+    auto const copy = values;
+    CHECK (copy == values);
+    CHECK (!copy.segment<bool> ()[0]);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+#include <ml/movar/container.hpp>
+#include <doctest/doctest.h>
+#include <array>
+#include <cstdint>
+#include <string>
+
+TEST_CASE ("column")
+{
+  using namespace ml::movar;
+
+  using shape = maybe<int, double, std::string>;
+  using column = variant_column_for<shape>;
+  static_assert (std::same_as<column, variant_column<int, double, std::string>>);
+
+  // 40 rows, so that scans cover both full blocks and a tail.
+  column shapes;
+  CHECK (shapes.empty ());
+  for (int i = 0; i != 40; ++i) {
+    if (i % 5 == 0)
+      shapes.push_back (shape ());
+    else if (i % 5 == 1)
+      shapes.push_back (shape (std::to_string (i)));
+    else if (i % 5 == 2)
+      shapes.push_back (i + 0.5);
+    else
+      shapes.push_back (i);
+  }
+  shapes.push_back (option<int> (100));
+  shapes.push_back (nothing ());
+  shapes.emplace_back<std::string> (2, 'z');
+
+  CHECK (shapes.size () == 43);
+  CHECK (shapes.count<int> () == 17);
+  CHECK (shapes.count<double> () == 8);
+  CHECK (shapes.count<std::string> () == 9);
+  CHECK (shapes.count<nothing> () == 9);
+  CHECK (shapes.tags ()[1] == 3);
+  CHECK (shapes.segment<int> ()[0] == 3);
+
+  CHECK (shapes[0].is_nothing ());
+  CHECK (shapes[1].get<std::string const> () == "1");
+  CHECK (shapes[2].get<double const> () == 2.5);
+  CHECK (shapes[40].get<int const> () == 100);
+  CHECK (shapes[41].is_nothing ());
+  CHECK (shapes[42].get<2> () == "zz");
+
+  auto const strings = shapes.positions<std::string> ();
+  REQUIRE (strings.size () == 9);
+  CHECK (strings[0] == 1);
+  CHECK (strings[7] == 36);
+  CHECK (strings[8] == 42);
+
+  auto const empty = shapes.positions<nothing> ();
+  REQUIRE (empty.size () == 9);
+  CHECK (empty[3] == 15);
+  CHECK (empty[8] == 41);
+
+  SUBCASE ("gather and select")
+  {
+    std::vector<std::uint32_t> const rows {42, 0, 3, 2};
+    auto const gathered = shapes.gather (rows);
+    REQUIRE (gathered.size () == 4);
+    CHECK (gathered[0].get<std::string const> () == "zz");
+    CHECK (gathered[1].is_nothing ());
+    CHECK (gathered[2].get<int const> () == 3);
+    CHECK (gathered[3].get<double const> () == 2.5);
+
+    std::array<bool, 43> mask {};
+    for (auto row : strings)
+      mask[row] = true;
+    auto const selected = shapes.select (mask);
+    CHECK (selected.size () == 9);
+    CHECK (selected.count<std::string> () == 9);
+    CHECK (selected[8].get<std::string const> () == "zz");
+    CHECK (selected == shapes.gather (strings));
+    CHECK (selected != gathered);
+  }
+
+  SUBCASE ("map")
+  {
+    auto const sizes = shapes.map ([] (auto const& x) -> std::size_t {
+      if constexpr (std::same_as<decltype (x), std::string const&>)
+        return x.size ();
+      else
+        return static_cast<std::size_t> (x);
+    });
+    static_assert (std::same_as<decltype (sizes), variant_column<std::size_t> const>);
+    REQUIRE (sizes.size () == shapes.size ());
+    CHECK (sizes.count<nothing> () == 9);
+    CHECK (sizes[0].is_nothing ());
+    CHECK (sizes[1].get<0> () == 1);
+    CHECK (sizes[2].get<0> () == 2);
+    CHECK (sizes[3].get<0> () == 3);
+    CHECK (sizes[40].get<0> () == 100);
+    CHECK (sizes[42].get<0> () == 2);
+
+    auto const doubled = shapes.map ([] (auto const& x) {
+      if constexpr (std::same_as<decltype (x), int const&>)
+        return 2 * x;
+      else
+        return nothing ();
+    });
+    static_assert (std::same_as<decltype (doubled), variant_column<int> const>);
+    CHECK (doubled.count<int> () == 17);
+    CHECK (doubled.count<nothing> () == 26);
+    CHECK (doubled[2].is_nothing ());
+    CHECK (doubled[3].get<int const> () == 6);
+  }
+
+  SUBCASE ("match")
+  {
+    auto const names = shapes.match ([] (auto const& x) -> std::string {
+      if constexpr (std::same_as<decltype (x), nothing const&>)
+        return "-";
+      else if constexpr (std::same_as<decltype (x), std::string const&>)
+        return x;
+      else
+        return std::to_string (static_cast<int> (x));
+    });
+    static_assert (std::same_as<decltype (names), variant_column<std::string> const>);
+    CHECK (names.count<nothing> () == 0);
+    CHECK (names[0].get<0> () == "-");
+    CHECK (names[1].get<0> () == "1");
+    CHECK (names[2].get<0> () == "2");
+    CHECK (names[41].get<0> () == "-");
+    CHECK (names[42].get<0> () == "zz");
+  }
+
+  SUBCASE ("clear")
+  {
+    auto copy = shapes;
+    CHECK (copy == shapes);
+    copy.clear ();
+    CHECK (copy.empty ());
+    CHECK (copy.count<nothing> () == 0);
+  }
+  SUBCASE ("bool")
+  {
+    variant_column_for<maybe<std::int32_t, bool>> flags;
+    flags.push_back (maybe<std::int32_t, bool> (true));
+    flags.push_back (maybe<std::int32_t, bool> ());
+    flags.push_back (std::int32_t (3));
+    flags.emplace_back<bool> () = true;
+    flags.push_back (false);
+    CHECK (flags.count<bool> () == 3);
+    CHECK (flags.segment<bool> ().size () == 3);
+    CHECK (flags[3].get<bool const> ());
+    CHECK (!flags[4].get<bool const> ());
+
+    auto const negated = flags.map ([] (auto x) { return !x; });
+    static_assert (std::same_as<decltype (negated), variant_column<bool> const>);
+    CHECK (negated[0].get<0> () == false);
+    CHECK (negated[1].is_nothing ());
+    CHECK (negated[2].get<0> () == false);
+    CHECK (negated[4].get<0> () == true);
+
+    auto const copy = flags;
+    CHECK (copy == flags);
+  }
+}
\ No newline at end of file
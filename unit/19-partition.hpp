@@ -0,0 +1,109 @@
+#pragma once
+#include <ml/movar/container.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace partition_test
+{
+  // Moves that may throw select the fallback of stable_sort_by_index.
+  struct throwing_move
+  {
+    std::string value;
+
+    throwing_move (int value)
+      : value (std::to_string (value))
+    {}
+
+    throwing_move (throwing_move&& other) noexcept (false)
+      : value (std::move (other.value))
+    {}
+
+    throwing_move& operator= (throwing_move&& other) noexcept (false)
+    {
+      value = std::move (other.value);
+      return *this;
+    }
+  };
+} // namespace partition_test
+
+TEST_CASE ("partition")
+{
+  using namespace ml::movar;
+
+  using event = maybe<int, std::string, double>;
+  std::vector<event> events;
+  for (int i = 0; i != 50; ++i) {
+    if (i % 4 == 0)
+      events.emplace_back (i);
+    else if (i % 4 == 1)
+      events.emplace_back (std::to_string (i));
+    else if (i % 4 == 2)
+      events.emplace_back (i + 0.5);
+    else
+      events.emplace_back ();
+  }
+
+  SUBCASE ("partition_by_alternative")
+  {
+    auto partitioned = events;
+    auto const groups = partition_by_alternative (partitioned);
+    CHECK (groups.all ().size () == 50);
+    CHECK (groups.segment<nothing> ().size () == 12);
+    CHECK (groups.segment<int> ().size () == 13);
+    CHECK (groups.segment<1> ().size () == 13);
+    CHECK (groups.segment (2).size () == 12);
+    CHECK (groups.segment<nothing> ().begin () == partitioned.begin ());
+    CHECK (groups.segment<double> ().end () == partitioned.end ());
+
+    for (long index = -1; index != 3; ++index)
+      for (auto const& e : groups.segment (index))
+        CHECK (e.index () == index);
+    CHECK (std::ranges::is_sorted (partitioned, {}, [] (event const& e) { return e.index (); }));
+
+    std::vector<event> sorted = events;
+    std::ranges::sort (sorted, index_first_less<event> {});
+    std::ranges::sort (partitioned, index_first_less<event> {});
+    CHECK (partitioned == sorted);
+  }
+
+  SUBCASE ("stable_sort_by_index")
+  {
+    auto sorted = events;
+    auto const groups = stable_sort_by_index (sorted);
+
+    auto expected = events;
+    std::ranges::stable_sort (expected, {}, [] (event const& e) { return e.index (); });
+    CHECK (sorted == expected);
+
+    auto const ints = groups.segment<int> ();
+    REQUIRE (ints.size () == 13);
+    CHECK (ints[0].get<int> () == 0);
+    CHECK (ints[12].get<int> () == 48);
+    CHECK (groups.segment<std::string> ()[1].get<std::string> () == "5");
+  }
+
+  SUBCASE ("alternatives only")
+  {
+    std::vector<either<int, std::string>> values {std::string ("b"), 1, std::string ("a"), 2};
+    auto const groups = stable_sort_by_index (values);
+    CHECK (groups.segment<int> ().size () == 2);
+    CHECK (values[1].get<int> () == 2);
+    CHECK (values[2].get<std::string> () == "b");
+
+    std::vector<either<int, partition_test::throwing_move>> throwing;
+    throwing.emplace_back (partition_test::throwing_move (1));
+    throwing.emplace_back (2);
+    throwing.emplace_back (partition_test::throwing_move (3));
+    throwing.emplace_back (4);
+    static_assert (!std::is_nothrow_move_constructible_v<either<int, partition_test::throwing_move>>);
+    CHECK (stable_sort_by_index (throwing).segment<1> ().size () == 2);
+    CHECK (throwing[1].get<int> () == 4);
+    CHECK (throwing[3].get<1> ().value == "3");
+
+    std::vector<either<int, std::string>> empty;
+    CHECK (partition_by_alternative (empty).all ().empty ());
+    CHECK (stable_sort_by_index (empty).segment<std::string> ().empty ());
+  }
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+#include <ml/movar/serialize.hpp>
+#include <doctest/doctest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace serialize_test
+{
+  // Serialized by the user, as its name followed by its weight.
+  struct tagged
+  {
+    std::string name;
+    int weight;
+
+    bool operator== (tagged const&) const = default;
+  };
+
+  inline void serialize (ml::movar::binary_writer& out, tagged const& value)
+  {
+    out.write (value.name);
+    out.write (value.weight);
+  }
+
+  inline ml::movar::option<tagged> deserialize (ml::movar::binary_reader& in, std::type_identity<tagged>)
+  {
+    auto name = in.read<std::string> ();
+    auto weight = in.read<int> ();
+    if (name.is_nothing () || weight.is_nothing ())
+      return ml::movar::nothing ();
+    if (weight.get () < 0) {
+      in.fail ();
+      return ml::movar::nothing ();
+    }
+    return tagged {std::move (name).get (), weight.get ()};
+  }
+
+  // Written as its object representation once opted in.
+  struct point
+  {
+    float x;
+    float y;
+
+    bool operator== (point const&) const = default;
+  };
+
+  // Trivially copyable, but its bytes are meaningless in another process.
+  struct handle
+  {
+    int const* target;
+  };
+
+  using value = ml::movar::maybe<int, std::string, std::vector<double>, //
+    ml::movar::option<ml::movar::either<char, tagged>>>;
+
+  inline value random_value (std::mt19937& random)
+  {
+    auto const number = [&random] (int bound) {
+      return std::uniform_int_distribution<int> (0, bound) (random);
+    };
+    switch (number (5)) {
+    case 0:
+      return value ();
+    case 1:
+      return number (1 << 20) - (1 << 19);
+    case 2:
+      return std::string (static_cast<std::size_t> (number (40)), static_cast<char> ('a' + number (25)));
+    case 3:
+      return std::vector<double> (static_cast<std::size_t> (number (8)), number (100) * 0.25);
+    case 4:
+      return ml::movar::option<ml::movar::either<char, tagged>> ();
+    default:
+      if (number (1) == 0)
+        return ml::movar::option<ml::movar::either<char, tagged>> (ml::movar::either<char, tagged> ('x'));
+      return ml::movar::option<ml::movar::either<char, tagged>> (ml::movar::either<char, tagged> (
+        tagged {std::string (static_cast<std::size_t> (number (5)), 'n'), number (1000)}));
+    }
+  }
+} // namespace serialize_test
+
+template<>
+inline constexpr bool ml::movar::enable_bitwise<serialize_test::point> = true;
+
+TEST_CASE ("serialize")
+{
+  using namespace ml::movar;
+  using serialize_test::tagged;
+  using serialize_test::value;
+
+  static_assert (Serializable<value> && Deserializable<value>);
+  static_assert (Serializable<maybe_ref<int, std::string>> && !Deserializable<maybe_ref<int, std::string>>);
+  static_assert (!Serializable<int*> && !Serializable<std::vector<bool>>);
+  static_assert (!Serializable<serialize_test::handle> && !Serializable<std::span<int const>>);
+  static_assert (Serializable<std::string_view> && !Deserializable<std::string_view>);
+  static_assert (Serializable<std::array<serialize_test::point, 2>> && Deserializable<serialize_test::point>);
+
+  std::vector<std::byte> buffer (1 << 16);
+
+  SUBCASE ("round trip")
+  {
+    std::mt19937 random (20240229);
+    std::vector<value> values;
+    for (int i = 0; i != 500; ++i)
+      values.push_back (serialize_test::random_value (random));
+
+    binary_writer out (buffer);
+    for (value const& v : values)
+      out.write (v);
+    REQUIRE (out.ok ());
+
+    binary_reader in (out.written ());
+    for (value const& v : values) {
+      option<value> const read = in.read<value> ();
+      REQUIRE (read.is_something ());
+      CHECK (read.get () == v);
+    }
+    CHECK (in.ok ());
+    CHECK (in.remaining ().empty ());
+    CHECK (in.read<value> ().is_nothing ());
+    CHECK (!in.ok ());
+  }
+
+  SUBCASE ("tags")
+  {
+    binary_writer out (buffer);
+    out.write (just<int> (7));
+    CHECK (out.size () == sizeof (int));
+    out.write (option<int> ());
+    CHECK (out.size () == sizeof (int) + 1);
+    out.write (either<char, int> ('c'));
+    CHECK (out.size () == sizeof (int) + 3);
+    out.write (std::vector<int> {1, 2, 3});
+    CHECK (out.size () == sizeof (int) + 4 + 3 * sizeof (int));
+
+    binary_reader in (out.written ());
+    CHECK (in.read<just<int>> ().get () == just<int> (7));
+    CHECK (in.read<option<int>> ().get ().is_nothing ());
+    CHECK (in.read<either<char, int>> ().get () == either<char, int> ('c'));
+    CHECK (in.read<std::vector<int>> ().get () == std::vector<int> {1, 2, 3});
+    CHECK (in.remaining ().empty ());
+
+    std::byte const invalid[] {std::byte (3), std::byte ('c'), std::byte (0), std::byte (0), std::byte (0)};
+    for (std::size_t size : {2, 5}) {
+      auto const prefix = std::span (invalid).first (size);
+      binary_reader bad (prefix);
+      CHECK (bad.read<either<char, int>> ().is_nothing ());
+      CHECK (!bad.ok ());
+    }
+  }
+
+  SUBCASE ("pointers")
+  {
+    // a string view is written with its characters, not its address, and read back as a string
+    std::string const text = "movar";
+    binary_writer out (buffer);
+    out.write (std::string_view (text));
+    out.write (variant<serialize_test::point, int> (serialize_test::point {1, 2}));
+    CHECK (out.size () == 1 + text.size () + 1 + sizeof (serialize_test::point));
+
+    binary_reader in (out.written ());
+    CHECK (in.read<std::string> ().get () == text);
+    CHECK (in.read<variant<serialize_test::point, int>> ().get ().get<0> () == serialize_test::point {1, 2});
+    CHECK (in.remaining ().empty ());
+  }
+
+  SUBCASE ("varint")
+  {
+    binary_writer out (buffer);
+    for (std::uint64_t v : {std::uint64_t (0), std::uint64_t (127), std::uint64_t (128), ~std::uint64_t (0)})
+      out.write_varint (v);
+    CHECK (out.size () == 1 + 1 + 2 + 10);
+
+    binary_reader in (out.written ());
+    CHECK (in.read_varint ().get () == 0);
+    CHECK (in.read_varint ().get () == 127);
+    CHECK (in.read_varint ().get () == 128);
+    CHECK (in.read_varint ().get () == ~std::uint64_t (0));
+    CHECK (in.read_varint ().is_nothing ());
+  }
+
+  SUBCASE ("truncated and invalid input")
+  {
+    value const original = option<either<char, tagged>> (either<char, tagged> (tagged {"name", 3}));
+    binary_writer out (buffer);
+    out.write (original);
+    std::span<std::byte const> const bytes = out.written ();
+
+    for (std::size_t size = 0; size != bytes.size (); ++size) {
+      binary_reader in (bytes.first (size));
+      CHECK (in.read<value> ().is_nothing ());
+      CHECK (!in.ok ());
+    }
+    CHECK (binary_reader (bytes).read<value> ().get () == original);
+
+    binary_writer bitwise (buffer);
+    bitwise.write (maybe<char, double> (2.5));
+    for (std::size_t size = 0; size != bitwise.size (); ++size)
+      CHECK (binary_reader (bitwise.written ().first (size)).read<maybe<char, double>> ().is_nothing ());
+
+    binary_writer negative (buffer);
+    negative.write (tagged {"name", -1});
+    binary_reader in (negative.written ());
+    CHECK (in.read<tagged> ().is_nothing ());
+    CHECK (!in.ok ());
+
+    std::byte const huge[] {std::byte (0xff), std::byte (0xff), std::byte (0xff), std::byte (0x0f)};
+    CHECK (binary_reader (huge).read<std::vector<int>> ().is_nothing ());
+  }
+
+  SUBCASE ("overflow")
+  {
+    std::byte small[6];
+    binary_writer out (small);
+    out.write (option<int> (1));
+    CHECK (out.ok ());
+    out.write (std::string ("ab"));
+    CHECK (!out.ok ());
+    CHECK (out.size () == 6);
+    out.write (char ('c'));
+    CHECK (out.size () == 6);
+  }
+}
\ No newline at end of file
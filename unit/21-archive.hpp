@@ -0,0 +1,120 @@
+#pragma once
+#include "common.hpp"
+#include <ml/movar/serialize.hpp>
+#include <ml/movar/stream.hpp>
+#include <doctest/doctest.h>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace archive_test
+{
+  struct point
+  {
+    float x;
+    float y;
+
+    bool operator== (point const&) const = default;
+  };
+
+  template<class Var>
+  concept archivable = requires (ml::movar::variant_column_for<Var> const& column) { make_archive (column); };
+} // namespace archive_test
+
+template<>
+inline constexpr bool ml::movar::enable_bitwise<archive_test::point> = true;
+
+TEST_CASE ("archive")
+{
+  using namespace ml::movar;
+  using archive_test::archivable;
+  using archive_test::point;
+
+  using value = maybe<std::int64_t, point, std::array<char, 3>>;
+  using archive = variant_archive_for<value>;
+  static_assert (std::same_as<archive, variant_archive<std::int64_t, point, std::array<char, 3>>>);
+  static_assert (archivable<value>);
+  static_assert (!archivable<maybe<int, std::string_view>> && !archivable<maybe<int, int*>>);
+
+  variant_column_for<value> column;
+  for (int i = 0; i != 100; ++i) {
+    if (i % 4 == 0)
+      column.push_back (value ());
+    else if (i % 4 == 1)
+      column.push_back (std::int64_t (i) << 40);
+    else if (i % 4 == 2)
+      column.push_back (point {float (i), -float (i)});
+    else
+      column.push_back (std::array<char, 3> {'a', 'b', char ('0' + i % 10)});
+  }
+  std::vector<std::byte> const bytes = make_archive (column);
+
+  auto const check = [&column] (archive const& view) {
+    REQUIRE (view.size () == column.size ());
+    CHECK (view.validate ());
+    CHECK (view.count<nothing> () == 25);
+    CHECK (view.count<point> () == 25);
+    CHECK (view.positions<std::int64_t> ()[3] == 13);
+    CHECK (view.segment<point> ()[1] == point {6, -6});
+    for (std::size_t row = 0; row != column.size (); ++row) {
+      CHECK (view[row].index () == column[row].index ());
+      CHECK (view.tags ()[row] == column.tags ()[row]);
+    }
+    CHECK (view[0].is_nothing ());
+    CHECK (view[1].get<std::int64_t const> () == std::int64_t (1) << 40);
+    CHECK (view[2].get<point const> () == point {2, -2});
+    CHECK (view[99].get<2> ()[2] == '9');
+  };
+
+  SUBCASE ("in memory")
+  {
+    option<archive> const view = archive::open (bytes);
+    REQUIRE (view.is_something ());
+    check (view.get ());
+    CHECK (&view.get ()[2].get<point const> () == view.get ().segment<point> ().data ());
+  }
+
+  SUBCASE ("mapped")
+  {
+    testing::temp_file const path ("movar-archive.bin", //
+      std::string_view (reinterpret_cast<char const*> (bytes.data ()), bytes.size ()));
+    option<mapped_file> const file = mapped_file::open (path.path);
+    REQUIRE (file.is_something ());
+    option<archive> const view = archive::open (file.get ().view ());
+    REQUIRE (view.is_something ());
+    check (view.get ());
+  }
+
+  SUBCASE ("invalid")
+  {
+    CHECK (archive::open (std::span (bytes).first (bytes.size () - 1)).is_nothing ());
+    CHECK (archive::open (std::span (bytes).first (40)).is_nothing ());
+    CHECK (variant_archive<std::int64_t, point>::open (bytes).is_nothing ());
+    CHECK (variant_archive<std::int32_t, point, std::array<char, 3>>::open (bytes).is_nothing ());
+
+    auto corrupted = bytes;
+    corrupted[0] = std::byte ('x');
+    CHECK (archive::open (corrupted).is_nothing ());
+
+    // the tags start at 128 and the positions at 256
+    corrupted = bytes;
+    corrupted[128] = std::byte (9);
+    REQUIRE (archive::open (corrupted).is_something ());
+    CHECK (!archive::open (corrupted).get ().validate ());
+
+    corrupted = bytes;
+    corrupted[256 + sizeof (std::uint32_t)] = std::byte (200);
+    REQUIRE (archive::open (corrupted).is_something ());
+    CHECK (!archive::open (corrupted).get ().validate ());
+  }
+
+  SUBCASE ("empty")
+  {
+    std::vector<std::byte> const empty = make_archive (variant_column_for<value> ());
+    option<archive> const view = archive::open (empty);
+    REQUIRE (view.is_something ());
+    CHECK (view.get ().empty ());
+    CHECK (view.get ().validate ());
+  }
+}
\ No newline at end of file
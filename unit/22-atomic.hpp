@@ -0,0 +1,148 @@
+#pragma once
+#include <ml/movar/atomic.hpp>
+#include <doctest/doctest.h>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace atomic_test
+{
+  // Too large for a lock-free word: written with four equal words, so a torn read is detectable.
+  struct block
+  {
+    std::array<std::uint64_t, 4> words;
+
+    bool consistent () const noexcept
+    {
+      return words[0] == words[1] && words[1] == words[2] && words[2] == words[3];
+    }
+
+    bool operator== (block const&) const = default;
+  };
+
+  // Equal values may differ in their padding bytes, so they cannot be compared by representation.
+  struct padded
+  {
+    char c;
+    int i;
+  };
+
+  template<class Var>
+  concept atomic = requires { typename ml::movar::atomic_value<Var>; };
+} // namespace atomic_test
+
+TEST_CASE ("atomic")
+{
+  using namespace ml::movar;
+  using atomic_test::atomic;
+  using atomic_test::block;
+
+  static_assert (atomic_option<int>::is_always_lock_free);
+  static_assert (atomic_variant<char, float>::is_always_lock_free);
+  static_assert (atomic_value<maybe<std::int32_t, std::array<char, 3>>>::is_always_lock_free);
+  static_assert (!atomic_option<block>::is_always_lock_free);
+  static_assert (!std::is_constructible_v<atomic_option<int>, atomic_option<int> const&>);
+  static_assert (atomic<variant<float, double>> && atomic<option<block>>);
+  static_assert (!atomic<option<atomic_test::padded>> && !atomic<option<long double>>);
+
+  SUBCASE ("option")
+  {
+    atomic_option<int> value;
+    CHECK (value.load ().is_nothing ());
+    value.store (3);
+    CHECK (value.load () == option<int> (3));
+    CHECK (value.load ().map ([] (int x) -> int { return x * 2; }) == option<int> (6));
+    CHECK (value.exchange (4) == option<int> (3));
+    CHECK (value.take () == option<int> (4));
+    CHECK (value.take ().is_nothing ());
+    CHECK (value.load ().is_nothing ());
+  }
+
+  SUBCASE ("variant")
+  {
+    atomic_variant<char, float> value (variant<char, float> ('a'));
+    variant<char, float> expected (2.5f);
+    CHECK (!value.compare_exchange_strong (expected, variant<char, float> ('b')));
+    CHECK (expected == variant<char, float> ('a'));
+    CHECK (value.compare_exchange_strong (expected, variant<char, float> (2.5f)));
+    CHECK (value.load ().match ([] (auto x) -> bool { return std::same_as<decltype (x), float>; }));
+
+    // equal payloads of different alternatives are different values
+    atomic_variant<std::int32_t, std::uint32_t> bits (variant<std::int32_t, std::uint32_t> (7));
+    variant<std::int32_t, std::uint32_t> unsigned_seven (std::in_place_index<1>, 7u);
+    CHECK (!bits.compare_exchange_strong (unsigned_seven, unsigned_seven));
+    CHECK (unsigned_seven.index () == 0);
+  }
+
+  SUBCASE ("sequence lock")
+  {
+    atomic_option<block> value;
+    CHECK (value.load ().is_nothing ());
+    value.store (block {{1, 1, 1, 1}});
+    option<block> expected (block {{1, 1, 1, 1}});
+    CHECK (value.compare_exchange_weak (expected, block {{2, 2, 2, 2}}));
+    CHECK (!value.compare_exchange_strong (expected, block {{3, 3, 3, 3}}));
+    CHECK (expected == option<block> (block {{2, 2, 2, 2}}));
+    CHECK (value.take () == option<block> (block {{2, 2, 2, 2}}));
+    CHECK (value.load ().is_nothing ());
+  }
+
+  SUBCASE ("concurrent increments")
+  {
+    constexpr int threads = 4;
+    constexpr int increments = 10000;
+    atomic_option<int> counter (0);
+    atomic_option<block> large (block {});
+
+    auto const increment = [] (auto& target, auto step) {
+      auto current = target.load ();
+      while (!target.compare_exchange_weak (current, step (current.get ())))
+        ;
+    };
+    std::vector<std::thread> workers;
+    for (int t = 0; t != threads; ++t)
+      workers.emplace_back ([&] {
+        for (int i = 0; i != increments; ++i) {
+          increment (counter, [] (int x) { return x + 1; });
+          increment (large, [] (block b) {
+            for (auto& word : b.words)
+              ++word;
+            return b;
+          });
+        }
+      });
+    for (auto& worker : workers)
+      worker.join ();
+
+    CHECK (counter.load () == option<int> (threads * increments));
+    CHECK (large.load () == option<block> (block {{threads * increments, threads * increments, //
+                              threads * increments, threads * increments}}));
+  }
+
+  SUBCASE ("no torn reads")
+  {
+    atomic_option<block> value (block {});
+    std::atomic<bool> done = false;
+    std::atomic<int> torn = 0;
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t != 2; ++t)
+      readers.emplace_back ([&] {
+        while (!done.load ()) {
+          option<block> const current = value.load ();
+          if (current.is_something () && !current.get ().consistent ())
+            ++torn;
+        }
+      });
+    for (std::uint64_t i = 1; i != 20000; ++i)
+      if (i % 3 == 0)
+        value.take ();
+      else
+        value.store (block {{i, i, i, i}});
+    done = true;
+    for (auto& reader : readers)
+      reader.join ();
+    CHECK (torn.load () == 0);
+  }
+}
\ No newline at end of file
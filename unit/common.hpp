@@ -0,0 +1,94 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// Helpers shared by the unit tests.
+namespace testing
+{
+  // Allocations performed through the global operator new, which the test drivers replace.
+  inline long allocations = 0;
+
+  // A payload that counts its copies and moves, whether by construction or assignment.
+  struct counted
+  {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    int value = 0;
+
+    counted () = default;
+
+    explicit counted (int v) noexcept
+      : value (v)
+    {}
+
+    counted (int a, int b) noexcept
+      : value (a + b)
+    {}
+
+    counted (counted const& other) noexcept
+      : value (other.value)
+    {
+      ++copies;
+    }
+
+    counted (counted&& other) noexcept
+      : value (other.value)
+    {
+      ++moves;
+    }
+
+    counted& operator= (counted const& other) noexcept
+    {
+      value = other.value;
+      ++copies;
+      return *this;
+    }
+
+    counted& operator= (counted&& other) noexcept
+    {
+      value = other.value;
+      ++moves;
+      return *this;
+    }
+
+    static void reset () noexcept
+    {
+      copies = 0;
+      moves = 0;
+    }
+  };
+
+  // A file in the temporary directory with a name unique to this run, removed on destruction.
+  struct temp_file
+  {
+    std::filesystem::path path;
+
+    temp_file (std::string const& name, std::string_view content)
+      : path (std::filesystem::temp_directory_path ()
+          / (name + "-" + std::to_string (std::random_device () ()) + "-" + std::to_string (next_id ())))
+    {
+      std::ofstream (path, std::ios::binary) //
+        .write (content.data (), static_cast<std::streamsize> (content.size ()));
+    }
+
+    temp_file (temp_file const&) = delete;
+    temp_file& operator= (temp_file const&) = delete;
+
+    ~temp_file ()
+    {
+      std::error_code ignored;
+      std::filesystem::remove (path, ignored);
+    }
+
+    static unsigned next_id ()
+    {
+      static unsigned id = 0;
+      return id++;
+    }
+  };
+} // namespace testing
\ No newline at end of file